@@ -4,24 +4,111 @@
 struct VSInput
 {
 	float3 position : POSITION; // ́F_W
+#if VERTEX_COLOR
 	float4 color : COLOR; // ́F_F
+#endif
+#if VERTEX_NORMAL
+	float2 normal : NORMAL; // ́Fʑ̃GR[h@
+#endif
+#if INSTANCE_STRUCTURED_BUFFER
+	uint instanceId : SV_InstanceID; // ́F`R}h̃CX^Xԍ
+#elif INSTANCE_COMPACT
+	float3 translation : TRANSLATION; // ́FCX^Ẍʒu
+	float4 instanceColor : COLOR1; // ́FCX^X̐FiRGBA8j
+	float4 rotation : ROTATION; // ́FCX^X̉]iNH[^jIj
+	float4 scale : SCALE; // ́FCX^X̊g嗦iw ͖gpj
+#else
+	float4 transform0 : TRANSFORM0; // ́FCX^X̃[hEr[EvWFNVs 1 s
+	float4 transform1 : TRANSFORM1; // ́FCX^X̃[hEr[EvWFNVs 2 s
+	float4 transform2 : TRANSFORM2; // ́FCX^X̃[hEr[EvWFNVs 3 s
+	float4 transform3 : TRANSFORM3; // ́FCX^X̃[hEr[EvWFNVs 4 s
+	float4 instanceColor : COLOR1; // ́FCX^X̐F
+#endif
 };
 
 // JRX^gobt@
+// s`̃CX^Xf[^̓r[sƃvWFNVs CPU ŏZς
+// k`̃CX^Xf[^ viewProjection ŕϊ
 cbuffer ConstantBuffer : register(b0)
 {
 	matrix view;
 	matrix projection;
+	matrix viewProjection;
 };
 
-// |SRX^gobt@
-cbuffer ConstantBuffer : register(b1)
+#if INSTANCE_STRUCTURED_BUFFER
+#if INSTANCE_COMPACT
+// kCX^Xf[^iC++  CompactInstanceData Ɠсj
+struct InstanceData
 {
-	matrix world;
-	float4 color;
+	float3 translation; // ʒu
+	uint color; // FiRGBA8AR ʃoCgj
+	uint2 rotation; // ]isnorm16 ̃NH[^jIj
+	uint2 scale; // g嗦ihalfAw ͖gpj
 };
+#else
+// CX^Xf[^iC++  InstanceData Ɠсj
+struct InstanceData
+{
+	row_major float4x4 transform; // [hEr[EvWFNVs
+	float4 color; // F
+};
+#endif
+
+// SIuWFNg̃CX^Xf[^
+StructuredBuffer<InstanceData> instances : register(t0);
+
+// `R}h̐擪CX^Xԍ
+cbuffer DrawConstants : register(b1)
+{
+	uint baseInstance;
+};
+#endif
 
 
+#if VERTEX_NORMAL
+// ʑ̃GR[h@𕜌iC++  VertexFormat Ƒ΂ɂȂj
+float3 decodeOctahedral(float2 e)
+{
+	float3 n = float3(e.x, e.y, 1.0f - abs(e.x) - abs(e.y));
+	if (n.z < 0.0f)
+	{
+		n.xy = (1.0f - abs(n.yx)) * (n.xy >= 0.0f ? 1.0f : -1.0f);
+	}
+	return normalize(n);
+}
+#endif
+
+#if INSTANCE_COMPACT
+// NH[^jIŃxNg]iC++  XMVector3Rotate Ɠj
+float3 rotateByQuaternion(float3 v, float4 q)
+{
+	return v + 2.0f * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
+
+#if INSTANCE_STRUCTURED_BUFFER
+// RGBA8 𕜌
+float4 unpackUnorm8(uint c)
+{
+	return float4(c & 0xff, (c >> 8) & 0xff, (c >> 16) & 0xff, c >> 24) / 255.0f;
+}
+
+// snorm16  4 𕜌
+float4 unpackSnorm16(uint2 v)
+{
+	// tŉEVtgďʃrbg𕄍g
+	int4 i = int4(asint(v.x << 16) >> 16, asint(v.x) >> 16, asint(v.y << 16) >> 16, asint(v.y) >> 16);
+	return max(float4(i) / 32767.0f, -1.0f);
+}
+
+// half  3 𕜌
+float3 unpackHalf3(uint2 v)
+{
+	return float3(f16tof32(v.x), f16tof32(v.x >> 16), f16tof32(v.y));
+}
+#endif
+#endif
+
 // _VF[_̏o͍\
 struct VSOutput
 {
@@ -40,14 +127,45 @@ VSOutput vs(VSInput input)
     // 3DW4DWɕϊ
 	float4 pos = float4(input.position, 1.0f);
 	
-	pos = mul(pos, world);		// |S̃[hsŃ[hϊ	
-	pos = mul(pos, view);		// J̃r[sŃr[ϊ
-	pos = mul(pos, projection); // J̃vWFNVsŃvWFNVϊ
+#if INSTANCE_COMPACT
+#if INSTANCE_STRUCTURED_BUFFER
+	// 擪CX^XԍƃCX^Xԍ玩̃f[^oĕ
+	InstanceData instance = instances[baseInstance + input.instanceId];
+	float3 translation = instance.translation;
+	float4 rotation = unpackSnorm16(instance.rotation);
+	float3 scale = unpackHalf3(instance.scale);
+	float4 instanceColor = unpackUnorm8(instance.color);
+#else
+	float3 translation = input.translation;
+	float4 rotation = input.rotation;
+	float3 scale = input.scale.xyz;
+	float4 instanceColor = input.instanceColor;
+#endif
+	// gA]Asړ̏Ƀ[hϊĂr[EvWFNVϊ
+	pos.xyz = rotateByQuaternion(pos.xyz * scale, rotation) + translation;
+	pos = mul(pos, viewProjection);
+#else
+#if INSTANCE_STRUCTURED_BUFFER
+	// 擪CX^XԍƃCX^Xԍ玩̃f[^o
+	InstanceData instance = instances[baseInstance + input.instanceId];
+	float4x4 transform = instance.transform;
+	float4 instanceColor = instance.color;
+#else
+	float4x4 transform = float4x4(input.transform0, input.transform1, input.transform2, input.transform3);
+	float4 instanceColor = input.instanceColor;
+#endif
+	pos = mul(pos, transform);	// [hEr[EvWFNVϊ1ōs
+#endif
 	
 	output.position = pos;
     
-    // F̂܂܎̒iKɓn
-	output.color = input.color;
+#if VERTEX_COLOR
+    // |S̐Fƒ_FZĎ̒iKɓn
+	output.color = input.color * instanceColor;
+#else
+    // _FȂtH[}bgł̓|S̐F̂܂ܓn
+	output.color = instanceColor;
+#endif
     
 	return output;
 }
@@ -57,6 +175,6 @@ VSOutput vs(VSInput input)
 // -------------------------------
 float4 ps(VSOutput input) : SV_TARGET
 {
-	// |S̐Fƒ_FZďo
-	return input.color * color;
+	// _VF[_ŏZς݂̐F̂܂܏o
+	return input.color;
 }
\ No newline at end of file
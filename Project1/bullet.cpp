@@ -1,10 +1,6 @@
 // eNX
 
 #include "bullet.h"
-#include "enemy.h"
-
-#include <typeinfo>
-
 
 #include "shape_container.h"
 #include "quad_polygon.h"
@@ -26,6 +22,9 @@ namespace game {
             DirectX::XMStoreFloat3(&parentPos, parent.value()->world().r[3]);
         }
         set(parentPos, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 0.0f, 0.0f, 1.0f, 0.3f }, quadId);
+
+        // GC[Ƃ̂ݏՓ˂
+        setCollision(CollisionLayer::Bullet, layerMask(CollisionLayer::Enemy));
     }
 
     //---------------------------------------------------------------------------------
@@ -39,26 +38,19 @@ namespace game {
         // ͏
         DirectX::XMFLOAT3 pos{};
         pos.z += moveSpeed;
-        // [hs̍XV
-        world_ = DirectX::XMMatrixMultiply(world_, DirectX::XMMatrixTranslation(pos.x, pos.y, pos.z));
+        // ʒuƃ[hs̍XV
+        translate(pos);
 
         GameObjectManager::instance().registerHit(handle());
     }
 
     //---------------------------------------------------------------------------------
     /**
-     * @brief	qbg̏
+     * @brief	qbgn߂̏
+     * @param	other	Փˑ̃IuWFNgnh
      */
-    void Bullet::onHit() noexcept {
+    void Bullet::onHitEnter([[maybe_unused]] UINT64 other) noexcept {
         GameObjectManager::instance().registerDelete(handle());
     }
 
-    //---------------------------------------------------------------------------------
-    /**
-     * @brief	qbgΏ
-     */
-    [[nodiscard]] UINT64 Bullet::hitTargetTypeId() noexcept {
-        return typeid(Enemy).hash_code();
-    }
-
 }  // namespace game
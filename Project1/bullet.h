@@ -43,14 +43,9 @@ namespace game {
     public:
         //---------------------------------------------------------------------------------
         /**
-         * @brief	qbg̏
+         * @brief	qbgn߂̏
+         * @param	other	Փˑ̃IuWFNgnh
          */
-        virtual void onHit() noexcept override;
-
-        //---------------------------------------------------------------------------------
-        /**
-         * @brief	qbgΏ
-         */
-        [[nodiscard]] virtual UINT64 hitTargetTypeId() noexcept override;
+        virtual void onHitEnter(UINT64 other) noexcept override;
     };
 }  // namespace game
@@ -4,19 +4,23 @@
 #include <cmath>
 
 #include "input.h"
+#include "swap_chain.h"
 
 namespace {
     // 萔
     constexpr float eyeMoveSpeed_ = 0.06f;  // Jړx
     constexpr float destTargetToView_ = -5.0f;  // _J܂ł̋
+    constexpr float nearClip_ = 0.1f;           // jANbv
+    constexpr float farClip_ = 100.0f;          // t@[Nbv
 
     //---------------------------------------------------------------------------------
     /**
      * @brief	RX^gobt@pf[^\
      */
     struct ConstBufferData {
-        DirectX::XMMATRIX view_{};        /// r[s
-        DirectX::XMMATRIX projection_{};  /// ˉes
+        DirectX::XMMATRIX view_{};            /// r[s
+        DirectX::XMMATRIX projection_{};      /// ˉes
+        DirectX::XMMATRIX viewProjection_{};  /// r[sƎˉesZs(kCX^Xf[^Ŏg)
     };
 
 }  // namespace
@@ -41,8 +45,8 @@ namespace game {
         projection_ = DirectX::XMMatrixPerspectiveFovLH(
             DirectX::XM_PIDIV4,  // p45x
             1280.0f / 720.0f,    // AXyNg
-            0.1f,                // jANbv
-            100.0f               // t@[Nbv
+            nearClip_,           // jANbv
+            farClip_             // t@[Nbv
         );
     }
 
@@ -63,7 +67,8 @@ namespace game {
      * @brief	`pobt@̍쐬
      */
     void Camera::createDrawBuffer() noexcept {
-        if (!constantBuffer_.create(sizeof(ConstBufferData))) {
+        // ̃t[Ə݂Ȃ悤Ƀt[Ɋmۂ
+        if (!constantBuffer_.create(sizeof(ConstBufferData), SwapChain::bufferCount)) {
             assert(false && "JpRX^gobt@̍쐬Ɏs܂");
         }
     }
@@ -71,9 +76,11 @@ namespace game {
     //---------------------------------------------------------------------------------
     /**
      * @brief	`pobt@̍XV
+     * @param	frameIndex	t[CfbNX
      */
-    void Camera::updateDrawBuffer() noexcept {
-        Object::updateConstantBuffer(ConstBufferData{ DirectX::XMMatrixTranspose(view_), DirectX::XMMatrixTranspose(projection_) });
+    void Camera::updateDrawBuffer(UINT frameIndex) noexcept {
+        Object::updateConstantBuffer(frameIndex, ConstBufferData{ DirectX::XMMatrixTranspose(view_), DirectX::XMMatrixTranspose(projection_),
+                                                     DirectX::XMMatrixTranspose(DirectX::XMMatrixMultiply(view_, projection_)) });
     }
 
     //---------------------------------------------------------------------------------
@@ -93,4 +100,13 @@ namespace game {
     [[nodiscard]] DirectX::XMMATRIX XM_CALLCONV Camera::projection() const noexcept {
         return projection_;
     }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief   t@[Nbv܂ł̋擾
+     * @return	t@[Nbv܂ł̋
+     */
+    [[nodiscard]] float Camera::farClip() const noexcept {
+        return farClip_;
+    }
 }  // namespace game
\ No newline at end of file
@@ -48,8 +48,9 @@ namespace game {
         //---------------------------------------------------------------------------------
         /**
          * @brief	`pobt@̍XV
+         * @param	frameIndex	t[CfbNX
          */
-        virtual void updateDrawBuffer() noexcept override;
+        virtual void updateDrawBuffer(UINT frameIndex) noexcept override;
 
     public:
         //---------------------------------------------------------------------------------
@@ -66,6 +67,13 @@ namespace game {
          */
         [[nodiscard]] DirectX::XMMATRIX XM_CALLCONV projection() const noexcept;
 
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief   t@[Nbv܂ł̋擾
+         * @return	t@[Nbv܂ł̋
+         */
+        [[nodiscard]] float farClip() const noexcept;
+
     private:
         DirectX::XMMATRIX view_{};        /// r[s
         DirectX::XMMATRIX projection_{};  /// ˉes
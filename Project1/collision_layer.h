@@ -0,0 +1,60 @@
+// Փ˃C[`
+
+#pragma once
+
+#include <cstdint>
+
+namespace game {
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Փ˃C[
+     * ő collisionLayerMax ܂Œ`ł
+     */
+    enum class CollisionLayer : uint32_t {
+        Default,  /// 背C[
+        Player,   /// vC[
+        Enemy,    /// G
+        Bullet,   /// e
+    };
+
+    /// Փ˃C[}XNirbgɑΏۃC[\j
+    using CollisionMask = uint32_t;
+
+    /// Փ˃C[̍ő吔
+    constexpr uint32_t collisionLayerMax = 32;
+
+    /// SC[ΏۂƂ}XN
+    constexpr CollisionMask collisionMaskAll = ~CollisionMask{};
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	C[ԍ̎擾
+     * @param	layer	Փ˃C[
+     * @return	C[ԍ
+     */
+    [[nodiscard]] constexpr uint32_t layerIndex(CollisionLayer layer) noexcept {
+        return static_cast<uint32_t>(layer);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	C[̃}XNrbg̎擾
+     * @param	layer	Փ˃C[
+     * @return	}XNrbg
+     */
+    [[nodiscard]] constexpr CollisionMask layerBit(CollisionLayer layer) noexcept {
+        return CollisionMask{ 1 } << layerIndex(layer);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	C[̃}XN̍쐬
+     * @param	layers	Փ˃C[
+     * @return	}XN
+     */
+    template <class... Layers>
+    [[nodiscard]] constexpr CollisionMask layerMask(Layers... layers) noexcept {
+        return (CollisionMask{} | ... | layerBit(layers));
+    }
+}  // namespace game
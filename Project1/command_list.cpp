@@ -36,6 +36,15 @@ void CommandList::reset(const CommandAllocator& commandAllocator) noexcept {
 
     // R}hXgZbg
     commandList_->Reset(commandAllocator.get(), nullptr);
+    // v͂ǂL^̃t[̕ɂ̂ŁAZbgOɑO̕c
+    previousStats_ = { stateCache_.stats(), barrierTracker_.stats() };
+
+    // ZbgŃXe[g͏Ԃɖ߂
+    stateCache_.invalidate();
+    stateCache_.resetStats();
+    // \[X̃Xe[g̓t[܂ŎĉŁAvZbg
+    assert(barrierTracker_.pending().empty() && "sĂȂoAcĂ܂");
+    barrierTracker_.resetStats();
 }
 
 //---------------------------------------------------------------------------------
@@ -48,4 +57,287 @@ void CommandList::reset(const CommandAllocator& commandAllocator) noexcept {
         assert(false && "R}hXg쐬ł");
     }
     return commandList_.Get();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	pCvCXe[gݒ肷
+ * @param	pipelineState	pCvCXe[g
+ */
+void CommandList::setPipelineState(ID3D12PipelineState* pipelineState) const noexcept {
+    if (stateCache_.setPipelineState(pipelineState)) {
+        commandList_->SetPipelineState(pipelineState);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	[gVOl`ݒ肷
+ * @param	rootSignature	[gVOl`
+ */
+void CommandList::setGraphicsRootSignature(ID3D12RootSignature* rootSignature) const noexcept {
+    if (stateCache_.setRootSignature(rootSignature)) {
+        commandList_->SetGraphicsRootSignature(rootSignature);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	CBV/SRV/UAV fBXNv^q[vݒ肷
+ * @param	heap	fBXNv^q[v
+ */
+void CommandList::setDescriptorHeap(ID3D12DescriptorHeap* heap) const noexcept {
+    if (stateCache_.setDescriptorHeap(heap)) {
+        ID3D12DescriptorHeap* heaps[] = { heap };
+        commandList_->SetDescriptorHeaps(1, heaps);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	fBXNv^e[uݒ肷
+ * @param	index	[gp[^ԍ
+ * @param	handle	GPU fBXNv^nh
+ */
+void CommandList::setGraphicsRootDescriptorTable(UINT index, D3D12_GPU_DESCRIPTOR_HANDLE handle) const noexcept {
+    if (stateCache_.setDescriptorTable(index, handle)) {
+        commandList_->SetGraphicsRootDescriptorTable(index, handle);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	[g SRV ݒ肷
+ * @param	index	[gp[^ԍ
+ * @param	address	GPU zAhX
+ */
+void CommandList::setGraphicsRootShaderResourceView(UINT index, D3D12_GPU_VIRTUAL_ADDRESS address) const noexcept {
+    if (stateCache_.setShaderResourceView(index, address)) {
+        commandList_->SetGraphicsRootShaderResourceView(index, address);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	[g萔ݒ肷
+ * @param	index	[gp[^ԍ
+ * @param	value	l
+ * @param	offset	[gp[^ 32 rbgPʂ̃ItZbg
+ */
+void CommandList::setGraphicsRoot32BitConstant(UINT index, UINT value, UINT offset) const noexcept {
+    if (stateCache_.set32BitConstant(index, value, offset)) {
+        commandList_->SetGraphicsRoot32BitConstant(index, value, offset);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_obt@ݒ肷
+ * @param	slot	̓Xbg
+ * @param	view	_obt@r[
+ */
+void CommandList::setVertexBuffer(UINT slot, const D3D12_VERTEX_BUFFER_VIEW& view) const noexcept {
+    if (stateCache_.setVertexBuffer(slot, view)) {
+        commandList_->IASetVertexBuffers(slot, 1, &view);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	CfbNXobt@ݒ肷
+ * @param	view	CfbNXobt@r[
+ */
+void CommandList::setIndexBuffer(const D3D12_INDEX_BUFFER_VIEW& view) const noexcept {
+    if (stateCache_.setIndexBuffer(view)) {
+        commandList_->IASetIndexBuffer(&view);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	v~eBu`ݒ肷
+ * @param	topology	v~eBu`
+ */
+void CommandList::setPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY topology) const noexcept {
+    if (stateCache_.setPrimitiveTopology(topology)) {
+        commandList_->IASetPrimitiveTopology(topology);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	r[|[gݒ肷
+ * @param	viewport	r[|[g
+ */
+void CommandList::setViewport(const D3D12_VIEWPORT& viewport) const noexcept {
+    if (stateCache_.setViewport(viewport)) {
+        commandList_->RSSetViewports(1, &viewport);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	VU[`ݒ肷
+ * @param	rect	VU[`
+ */
+void CommandList::setScissorRect(const D3D12_RECT& rect) const noexcept {
+    if (stateCache_.setScissorRect(rect)) {
+        commandList_->RSSetScissorRects(1, &rect);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Xe[gݒ̌Ăяo񐔂̓v擾
+ * reset() ̋L^̃t[̓v
+ * @return	Ăяo񐔂ƏȂ
+ */
+[[nodiscard]] const CommandStateCache::Stats& CommandList::stateStats() const noexcept {
+    return stateCache_.stats();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Xe[gJڂǐՂ郊\[Xo^
+ * @param	resource	\[X
+ * @param	state		݂̃Xe[g
+ */
+void CommandList::trackResource(ID3D12Resource* resource, D3D12_RESOURCE_STATES state) const noexcept {
+    barrierTracker_.track(resource, state);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[X̒ǐՂ
+ * @param	resource	\[X
+ */
+void CommandList::untrackResource(ID3D12Resource* resource) const noexcept {
+    barrierTracker_.untrack(resource);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[X̃Xe[gJڂv
+ * ݂̃Xe[gƓȂ牽ȂBoA͎̕`悩NȂOɂ܂Ƃ߂Ĕs
+ * @param	resource	\[X
+ * @param	after		Jڌ̃Xe[g
+ */
+void CommandList::transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES after) const noexcept {
+    barrierTracker_.transition(resource, after);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	oAŃ\[X̃Xe[gJڂJn
+ * @param	resource	\[X
+ * @param	after		Jڌ̃Xe[g
+ */
+void CommandList::beginTransition(ID3D12Resource* resource, D3D12_RESOURCE_STATES after) const noexcept {
+    barrierTracker_.beginTransition(resource, after);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	oÃXe[gJڂI
+ * @param	resource	\[X
+ */
+void CommandList::endTransition(ID3D12Resource* resource) const noexcept {
+    barrierTracker_.endTransition(resource);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	GCAVOoAv
+ * @param	after	gn߂郊\[X
+ */
+void CommandList::aliasingBarrier(ID3D12Resource* after) const noexcept {
+    barrierTracker_.aliasing(after);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	߂ĂoA1̌ĂяoŔs
+ */
+void CommandList::flushBarriers() const noexcept {
+    const auto& barriers = barrierTracker_.pending();
+    if (barriers.empty()) {
+        return;
+    }
+    commandList_->ResourceBarrier(static_cast<UINT>(barriers.size()), barriers.data());
+    barrierTracker_.markIssued();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_[^[QbgNA
+ * @param	view	_[^[Qbgr[
+ * @param	color	NAF
+ */
+void CommandList::clearRenderTargetView(D3D12_CPU_DESCRIPTOR_HANDLE view, const float (&color)[4]) const noexcept {
+    flushBarriers();
+    commandList_->ClearRenderTargetView(view, color, 0, nullptr);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	fvXobt@NA
+ * @param	view	fvXXeVr[
+ * @param	depth	NA[x
+ */
+void CommandList::clearDepthStencilView(D3D12_CPU_DESCRIPTOR_HANDLE view, float depth) const noexcept {
+    flushBarriers();
+    commandList_->ClearDepthStencilView(view, D3D12_CLEAR_FLAG_DEPTH, depth, 0, 0, nullptr);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	CfbNXt̃CX^X`
+ * @param	indexCount		1CX^X̃CfbNX
+ * @param	instanceCount	CX^X
+ * @param	startIndex		JnCfbNX
+ * @param	baseVertex		x[X_
+ * @param	startInstance	JnCX^X
+ */
+void CommandList::drawIndexedInstanced(UINT indexCount, UINT instanceCount, UINT startIndex, INT baseVertex, UINT startInstance) const noexcept {
+    flushBarriers();
+    commandList_->DrawIndexedInstanced(indexCount, instanceCount, startIndex, baseVertex, startInstance);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	obt@̓eŕ`悷
+ * R}hVOl`郋[ǵAȍ~̐ݒŕK API Ăяo
+ * @param	commandSignature	R}hVOl`
+ * @param	count				`̐
+ * @param	argumentBuffer		obt@(INDIRECT_ARGUMENT ܂ރXe[g)
+ * @param	offset				obt@̃ItZbg
+ */
+void CommandList::executeIndirect(const CommandSignature& commandSignature, UINT count, ID3D12Resource* argumentBuffer, UINT64 offset) const noexcept {
+    if (count == 0) {
+        return;
+    }
+    flushBarriers();
+    commandList_->ExecuteIndirect(commandSignature.get(), count, argumentBuffer, offset, nullptr, 0);
+    // s̃[g̒l͕sȂ̂ŁAL^j
+    stateCache_.invalidateRootArgument(commandSignature.rootParameterIndex());
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	oA̓v擾
+ * reset() ̋L^̃t[̓v
+ * @return	sƏȂ
+ */
+[[nodiscard]] const ResourceStateTracker::Stats& CommandList::barrierStats() const noexcept {
+    return barrierTracker_.stats();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ŐL^̓v擾
+ * reset() vZbgOɕۑAOɋL^t[̓v
+ * @return	Xe[gݒƃoA̓v
+ */
+[[nodiscard]] const CommandList::FrameStats& CommandList::previousFrameStats() const noexcept {
+    return previousStats_;
 }
\ No newline at end of file
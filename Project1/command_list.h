@@ -4,12 +4,28 @@
 
 #include "device.h"
 #include "command_allocator.h"
+#include "command_state_cache.h"
+#include "resource_state_tracker.h"
+#include "command_signature.h"
 
 //---------------------------------------------------------------------------------
 /**
  * @brief	R}hXgNX
+ * Xe[gݒ̊֐͐ݒς݂̒lƓꍇ API ̌ĂяoȂ
+ * get() Œڐݒ肵ꍇ̓LbVɔfȂ̂ŁAXe[g͊֐oRŐݒ肷邱
+ * \[X̃Xe[gJڂ transition() ŗvA߂oA͎̕`悩NȂOɂ܂Ƃ߂Ĕs
  */
 class CommandList final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	1t[̋L^̓v
+     */
+    struct FrameStats {
+        CommandStateCache::Stats    state{};    /// Xe[gݒ̓v
+        ResourceStateTracker::Stats barrier{};  /// oA̓v
+    };
+
 public:
     //---------------------------------------------------------------------------------
     /**
@@ -45,7 +61,205 @@ public:
      */
     [[nodiscard]] ID3D12GraphicsCommandList* get() const noexcept;
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pCvCXe[gݒ肷
+     * @param	pipelineState	pCvCXe[g
+     */
+    void setPipelineState(ID3D12PipelineState* pipelineState) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[gVOl`ݒ肷
+     * @param	rootSignature	[gVOl`
+     */
+    void setGraphicsRootSignature(ID3D12RootSignature* rootSignature) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CBV/SRV/UAV fBXNv^q[vݒ肷
+     * @param	heap	fBXNv^q[v
+     */
+    void setDescriptorHeap(ID3D12DescriptorHeap* heap) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	fBXNv^e[uݒ肷
+     * @param	index	[gp[^ԍ
+     * @param	handle	GPU fBXNv^nh
+     */
+    void setGraphicsRootDescriptorTable(UINT index, D3D12_GPU_DESCRIPTOR_HANDLE handle) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[g SRV ݒ肷
+     * @param	index	[gp[^ԍ
+     * @param	address	GPU zAhX
+     */
+    void setGraphicsRootShaderResourceView(UINT index, D3D12_GPU_VIRTUAL_ADDRESS address) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[g萔ݒ肷
+     * @param	index	[gp[^ԍ
+     * @param	value	l
+     * @param	offset	[gp[^ 32 rbgPʂ̃ItZbg
+     */
+    void setGraphicsRoot32BitConstant(UINT index, UINT value, UINT offset = 0) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_obt@ݒ肷
+     * @param	slot	̓Xbg
+     * @param	view	_obt@r[
+     */
+    void setVertexBuffer(UINT slot, const D3D12_VERTEX_BUFFER_VIEW& view) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CfbNXobt@ݒ肷
+     * @param	view	CfbNXobt@r[
+     */
+    void setIndexBuffer(const D3D12_INDEX_BUFFER_VIEW& view) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	v~eBu`ݒ肷
+     * @param	topology	v~eBu`
+     */
+    void setPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY topology) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	r[|[gݒ肷
+     * @param	viewport	r[|[g
+     */
+    void setViewport(const D3D12_VIEWPORT& viewport) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	VU[`ݒ肷
+     * @param	rect	VU[`
+     */
+    void setScissorRect(const D3D12_RECT& rect) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Xe[gJڂǐՂ郊\[Xo^
+     * @param	resource	\[X
+     * @param	state		݂̃Xe[g
+     */
+    void trackResource(ID3D12Resource* resource, D3D12_RESOURCE_STATES state) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X̒ǐՂ
+     * @param	resource	\[X
+     */
+    void untrackResource(ID3D12Resource* resource) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X̃Xe[gJڂv
+     * ݂̃Xe[gƓȂ牽ȂBoA͎̕`悩NȂOɂ܂Ƃ߂Ĕs
+     * @param	resource	\[X
+     * @param	after		Jڌ̃Xe[g
+     */
+    void transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES after) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	oAŃ\[X̃Xe[gJڂJn
+     * @param	resource	\[X
+     * @param	after		Jڌ̃Xe[g
+     */
+    void beginTransition(ID3D12Resource* resource, D3D12_RESOURCE_STATES after) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	oÃXe[gJڂI
+     * @param	resource	\[X
+     */
+    void endTransition(ID3D12Resource* resource) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	GCAVOoAv
+     * @param	after	gn߂郊\[X
+     */
+    void aliasingBarrier(ID3D12Resource* after) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	߂ĂoA1̌ĂяoŔs
+     */
+    void flushBarriers() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_[^[QbgNA
+     * @param	view	_[^[Qbgr[
+     * @param	color	NAF
+     */
+    void clearRenderTargetView(D3D12_CPU_DESCRIPTOR_HANDLE view, const float (&color)[4]) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	fvXobt@NA
+     * @param	view	fvXXeVr[
+     * @param	depth	NA[x
+     */
+    void clearDepthStencilView(D3D12_CPU_DESCRIPTOR_HANDLE view, float depth) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CfbNXt̃CX^X`
+     * @param	indexCount		1CX^X̃CfbNX
+     * @param	instanceCount	CX^X
+     * @param	startIndex		JnCfbNX
+     * @param	baseVertex		x[X_
+     * @param	startInstance	JnCX^X
+     */
+    void drawIndexedInstanced(UINT indexCount, UINT instanceCount, UINT startIndex, INT baseVertex, UINT startInstance) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	obt@̓eŕ`悷
+     * R}hVOl`郋[ǵAȍ~̐ݒŕK API Ăяo
+     * @param	commandSignature	R}hVOl`
+     * @param	count				`̐
+     * @param	argumentBuffer		obt@(INDIRECT_ARGUMENT ܂ރXe[g)
+     * @param	offset				obt@̃ItZbg
+     */
+    void executeIndirect(const CommandSignature& commandSignature, UINT count, ID3D12Resource* argumentBuffer, UINT64 offset) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Xe[gݒ̌Ăяo񐔂̓v擾
+     * reset() ̋L^̃t[̓v
+     * @return	Ăяo񐔂ƏȂ
+     */
+    [[nodiscard]] const CommandStateCache::Stats& stateStats() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	oA̓v擾
+     * reset() ̋L^̃t[̓v
+     * @return	sƏȂ
+     */
+    [[nodiscard]] const ResourceStateTracker::Stats& barrierStats() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ŐL^̓v擾
+     * reset() vZbgOɕۑAOɋL^t[̓v
+     * @return	Xe[gݒƃoA̓v
+     */
+    [[nodiscard]] const FrameStats& previousFrameStats() const noexcept;
 
 private:
-    Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandList_{};       /// R}hXg
+    Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandList_{};     /// R}hXg
+    mutable CommandStateCache                         stateCache_{};      /// ݒς݂̃Xe[g(L^ɍXV̂ mutable)
+    mutable ResourceStateTracker                      barrierTracker_{};  /// \[X̃Xe[gƗ߂ĂoA
+    FrameStats                                        previousStats_{};   /// ŐL^̓v
 };
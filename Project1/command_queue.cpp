@@ -6,13 +6,13 @@
 //---------------------------------------------------------------------------------
 /**
  * @brief	R}hL[̐
- * @param	device	foCXNX̃CX^X
+ * @param	type	R}hXg̃^Cv(]p̃L[ COPY w肷)
  * @return	 true
  */
-[[nodiscard]] bool CommandQueue::create() noexcept {
+[[nodiscard]] bool CommandQueue::create(D3D12_COMMAND_LIST_TYPE type) noexcept {
     // R}hL[̐ݒ
     D3D12_COMMAND_QUEUE_DESC desc{};
-    desc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;       // _CNgR}hL[
+    desc.Type = type;                                     // R}hXg̃^Cv
     desc.Priority = D3D12_COMMAND_QUEUE_PRIORITY_NORMAL;  // ʏDx
     desc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;        // ʃtOȂ
     desc.NodeMask = 0;                                    // GPU ͂ЂƂ̂ݎgp
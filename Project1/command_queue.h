@@ -25,9 +25,10 @@ public:
     //---------------------------------------------------------------------------------
     /**
      * @brief	R}hL[̐
+     * @param	type	R}hXg̃^Cv(]p̃L[ COPY w肷)
      * @return	̐
      */
-    [[nodiscard]] bool create() noexcept;
+    [[nodiscard]] bool create(D3D12_COMMAND_LIST_TYPE type = D3D12_COMMAND_LIST_TYPE_DIRECT) noexcept;
 
     //---------------------------------------------------------------------------------
     /**
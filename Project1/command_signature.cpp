@@ -0,0 +1,65 @@
+// R}hVOl`NX
+
+#include "command_signature.h"
+#include "indirect_argument_builder.h"
+#include <cassert>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	R}hVOl`쐬
+ * @param	rootSignature	[gVOl`(CX^Xf[^XgN`[hobt@œn)
+ * @return	 true
+ */
+[[nodiscard]] bool CommandSignature::create(const RootSignature& rootSignature) noexcept {
+    // 擪CX^Xԍ̃[g萔̓XgN`[hobt@œnꍇ̂ݑ݂
+    if (rootSignature.instanceBinding() != RootSignature::InstanceBinding::StructuredBuffer) {
+        assert(false && "R}hVOl`̓XgN`[hobt@œn[gVOl`ɂ̂ݍ쐬ł܂");
+        return false;
+    }
+
+    // ̕
+    // `͍̈ŌɒuKv
+    D3D12_INDIRECT_ARGUMENT_DESC argumentDescs[2]{};
+    argumentDescs[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+    argumentDescs[0].Constant.RootParameterIndex = RootSignature::instanceBaseParameterIndex;
+    argumentDescs[0].Constant.DestOffsetIn32BitValues = 0;
+    argumentDescs[0].Constant.Num32BitValuesToSet = 1;
+    argumentDescs[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+
+    D3D12_COMMAND_SIGNATURE_DESC desc{};
+    desc.ByteStride = sizeof(IndirectArgumentBuilder::Arguments);
+    desc.NumArgumentDescs = _countof(argumentDescs);
+    desc.pArgumentDescs = argumentDescs;
+    desc.NodeMask = 0;
+
+    // [ĝŃ[gVOl`w肷
+    const auto res = Device::instance().get()->CreateCommandSignature(&desc, rootSignature.get(), IID_PPV_ARGS(&commandSignature_));
+    if (FAILED(res)) {
+        assert(false && "R}hVOl`̍쐬Ɏs܂");
+        return false;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	R}hVOl`擾
+ * @return	R}hVOl`̃|C^
+ */
+[[nodiscard]] ID3D12CommandSignature* CommandSignature::get() const noexcept {
+    if (!commandSignature_) {
+        assert(false && "R}hVOl`쐬ł");
+    }
+    return commandSignature_.Get();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ŏ郋[gp[^̔ԍ擾
+ * ExecuteIndirect ̌͂̃[gp[^̒lsɂȂ
+ * @return	[gp[^ԍ
+ */
+[[nodiscard]] UINT CommandSignature::rootParameterIndex() const noexcept {
+    return RootSignature::instanceBaseParameterIndex;
+}
@@ -0,0 +1,53 @@
+// R}hVOl`NX
+
+#pragma once
+
+#include "device.h"
+#include "root_signature.h"
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	R}hVOl`NX
+ * ExecuteIndirect ̈̕т߂
+ * 擪CX^Xԍ̃[g萔ݒ肵Ă DrawIndexedInstanced Ă(IndirectArgumentBuilder::Arguments Ɠ)
+ */
+class CommandSignature final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    CommandSignature() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~CommandSignature() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	R}hVOl`쐬
+     * @param	rootSignature	[gVOl`(CX^Xf[^XgN`[hobt@œn)
+     * @return	 true
+     */
+    [[nodiscard]] bool create(const RootSignature& rootSignature) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	R}hVOl`擾
+     * @return	R}hVOl`̃|C^
+     */
+    [[nodiscard]] ID3D12CommandSignature* get() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ŏ郋[gp[^̔ԍ擾
+     * ExecuteIndirect ̌͂̃[gp[^̒lsɂȂ
+     * @return	[gp[^ԍ
+     */
+    [[nodiscard]] UINT rootParameterIndex() const noexcept;
+
+private:
+    Microsoft::WRL::ComPtr<ID3D12CommandSignature> commandSignature_{};  /// R}hVOl`
+};
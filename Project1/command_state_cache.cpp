@@ -0,0 +1,255 @@
+// R}hXg̃Xe[gLbVNX
+
+#include "command_state_cache.h"
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	L^Xe[gj
+ * R}hXg̃ZbgɌĂяoBv̓ZbgȂ
+ */
+void CommandStateCache::invalidate() noexcept {
+    const auto stats = stats_;
+    *this = CommandStateCache{};
+    stats_ = stats;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	L^[gj
+ * ExecuteIndirect Ȃǂ API ʂɒlςꍇɌĂяo
+ * @param	index	[gp[^ԍ
+ */
+void CommandStateCache::invalidateRootArgument(UINT index) noexcept {
+    if (index < rootParameterMax_) {
+        rootArguments_[index] = {};
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	v擾
+ * @return	v
+ */
+[[nodiscard]] const CommandStateCache::Stats& CommandStateCache::stats() const noexcept {
+    return stats_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	vZbg
+ */
+void CommandStateCache::resetStats() noexcept {
+    stats_ = {};
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	pCvCXe[g̐ݒ𔻒肷
+ * @param	pipelineState	pCvCXe[g
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setPipelineState(ID3D12PipelineState* pipelineState) noexcept {
+    const bool same = pipelineState_ == pipelineState;
+    pipelineState_ = pipelineState;
+    return update(same);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	[gVOl`̐ݒ𔻒肷
+ * [gVOl`ςꍇ̓[g̋L^j
+ * @param	rootSignature	[gVOl`
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setRootSignature(ID3D12RootSignature* rootSignature) noexcept {
+    const bool same = rootSignature_ == rootSignature;
+    if (!same) {
+        // [gVOl`ݒ肷ƃ[g͑SĖ`ɂȂ
+        rootArguments_ = {};
+    }
+    rootSignature_ = rootSignature;
+    return update(same);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	fBXNv^q[v̐ݒ𔻒肷
+ * q[vςꍇ̓fBXNv^e[űL^j
+ * @param	heap	CBV/SRV/UAV fBXNv^q[v
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setDescriptorHeap(ID3D12DescriptorHeap* heap) noexcept {
+    const bool same = descriptorHeap_ == heap;
+    if (!same) {
+        for (auto& argument : rootArguments_) {
+            if (argument.type == RootArgumentType::DescriptorTable) {
+                argument = {};
+            }
+        }
+    }
+    descriptorHeap_ = heap;
+    return update(same);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	fBXNv^e[u̐ݒ𔻒肷
+ * @param	index	[gp[^ԍ
+ * @param	handle	GPU fBXNv^nh
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setDescriptorTable(UINT index, D3D12_GPU_DESCRIPTOR_HANDLE handle) noexcept {
+    return setRootArgument(index, RootArgumentType::DescriptorTable, handle.ptr);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	[g SRV ̐ݒ𔻒肷
+ * @param	index	[gp[^ԍ
+ * @param	address	GPU zAhX
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setShaderResourceView(UINT index, D3D12_GPU_VIRTUAL_ADDRESS address) noexcept {
+    return setRootArgument(index, RootArgumentType::ShaderResource, address);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	[g萔̐ݒ𔻒肷
+ * 擪(ItZbg 0)̒l̂݋L^
+ * @param	index	[gp[^ԍ
+ * @param	value	l
+ * @param	offset	[gp[^ 32 rbgPʂ̃ItZbg
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::set32BitConstant(UINT index, UINT value, UINT offset) noexcept {
+    if (offset != 0) {
+        // L^ĂȂʒu͏ɐݒ肵A擪̋L^j
+        if (index < rootParameterMax_) {
+            rootArguments_[index] = {};
+        }
+        return update(false);
+    }
+    return setRootArgument(index, RootArgumentType::Constant, value);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_obt@̐ݒ𔻒肷
+ * @param	slot	̓Xbg
+ * @param	view	_obt@r[
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setVertexBuffer(UINT slot, const D3D12_VERTEX_BUFFER_VIEW& view) noexcept {
+    if (slot >= vertexSlotMax_) {
+        return update(false);
+    }
+
+    auto&      current = vertexBuffers_[slot];
+    const bool same = vertexBufferValid_[slot] &&
+        current.BufferLocation == view.BufferLocation &&
+        current.SizeInBytes == view.SizeInBytes &&
+        current.StrideInBytes == view.StrideInBytes;
+    current = view;
+    vertexBufferValid_[slot] = true;
+    return update(same);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	CfbNXobt@̐ݒ𔻒肷
+ * @param	view	CfbNXobt@r[
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setIndexBuffer(const D3D12_INDEX_BUFFER_VIEW& view) noexcept {
+    const bool same = indexBufferValid_ &&
+        indexBuffer_.BufferLocation == view.BufferLocation &&
+        indexBuffer_.SizeInBytes == view.SizeInBytes &&
+        indexBuffer_.Format == view.Format;
+    indexBuffer_ = view;
+    indexBufferValid_ = true;
+    return update(same);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	v~eBu`̐ݒ𔻒肷
+ * @param	topology	v~eBu`
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY topology) noexcept {
+    const bool same = topology_ != D3D_PRIMITIVE_TOPOLOGY_UNDEFINED && topology_ == topology;
+    topology_ = topology;
+    return update(same);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	r[|[g̐ݒ𔻒肷
+ * @param	viewport	r[|[g
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setViewport(const D3D12_VIEWPORT& viewport) noexcept {
+    const bool same = viewportValid_ &&
+        viewport_.TopLeftX == viewport.TopLeftX &&
+        viewport_.TopLeftY == viewport.TopLeftY &&
+        viewport_.Width == viewport.Width &&
+        viewport_.Height == viewport.Height &&
+        viewport_.MinDepth == viewport.MinDepth &&
+        viewport_.MaxDepth == viewport.MaxDepth;
+    viewport_ = viewport;
+    viewportValid_ = true;
+    return update(same);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	VU[`̐ݒ𔻒肷
+ * @param	rect	VU[`
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setScissorRect(const D3D12_RECT& rect) noexcept {
+    const bool same = scissorRectValid_ &&
+        scissorRect_.left == rect.left &&
+        scissorRect_.top == rect.top &&
+        scissorRect_.right == rect.right &&
+        scissorRect_.bottom == rect.bottom;
+    scissorRect_ = rect;
+    scissorRectValid_ = true;
+    return update(same);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	lrċL^XVAv𐔂
+ * @param	same	L^ς݂̒lƓ
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::update(bool same) noexcept {
+    if (same) {
+        ++stats_.eliminated;
+        return false;
+    }
+    ++stats_.issued;
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	[g̐ݒ𔻒肷
+ * @param	index	[gp[^ԍ
+ * @param	type	
+ * @param	value	ݒl
+ * @return	ĂяoKvȂ true
+ */
+[[nodiscard]] bool CommandStateCache::setRootArgument(UINT index, RootArgumentType type, UINT64 value) noexcept {
+    if (index >= rootParameterMax_) {
+        return update(false);
+    }
+
+    auto&      current = rootArguments_[index];
+    const bool same = current.type == type && current.value == value;
+    current.type = type;
+    current.value = value;
+    return update(same);
+}
@@ -0,0 +1,221 @@
+// R}hXg̃Xe[gLbVNX
+
+#pragma once
+
+#include <d3d12.h>
+#include <array>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	R}hXg̃Xe[gLbVNX
+ * R}hXgɐݒς݂̃Xe[gL^Al̍ĐݒȂǂ𔻒肷
+ * D3D12  API ͌ĂяoȂ̂ŁAfoCXĂ̓mFł
+ * e set ֐ API ̌ĂяoKvȏꍇ true Ԃ
+ */
+class CommandStateCache final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Ăяo񐔂̓v
+     */
+    struct Stats {
+        UINT issued{};      /// ĂяoKvƔ肵
+        UINT eliminated{};  /// 璷ƂďȂ
+    };
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    CommandStateCache() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~CommandStateCache() = default;
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	L^Xe[gj
+     * R}hXg̃ZbgɌĂяoBv̓ZbgȂ
+     */
+    void invalidate() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	L^[gj
+     * ExecuteIndirect Ȃǂ API ʂɒlςꍇɌĂяo
+     * @param	index	[gp[^ԍ
+     */
+    void invalidateRootArgument(UINT index) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	v擾
+     * @return	v
+     */
+    [[nodiscard]] const Stats& stats() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	vZbg
+     */
+    void resetStats() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pCvCXe[g̐ݒ𔻒肷
+     * @param	pipelineState	pCvCXe[g
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setPipelineState(ID3D12PipelineState* pipelineState) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[gVOl`̐ݒ𔻒肷
+     * [gVOl`ςꍇ̓[g̋L^j
+     * @param	rootSignature	[gVOl`
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setRootSignature(ID3D12RootSignature* rootSignature) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	fBXNv^q[v̐ݒ𔻒肷
+     * q[vςꍇ̓fBXNv^e[űL^j
+     * @param	heap	CBV/SRV/UAV fBXNv^q[v
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setDescriptorHeap(ID3D12DescriptorHeap* heap) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	fBXNv^e[u̐ݒ𔻒肷
+     * @param	index	[gp[^ԍ
+     * @param	handle	GPU fBXNv^nh
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setDescriptorTable(UINT index, D3D12_GPU_DESCRIPTOR_HANDLE handle) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[g SRV ̐ݒ𔻒肷
+     * @param	index	[gp[^ԍ
+     * @param	address	GPU zAhX
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setShaderResourceView(UINT index, D3D12_GPU_VIRTUAL_ADDRESS address) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[g萔̐ݒ𔻒肷
+     * 擪(ItZbg 0)̒l̂݋L^
+     * @param	index	[gp[^ԍ
+     * @param	value	l
+     * @param	offset	[gp[^ 32 rbgPʂ̃ItZbg
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool set32BitConstant(UINT index, UINT value, UINT offset) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_obt@̐ݒ𔻒肷
+     * @param	slot	̓Xbg
+     * @param	view	_obt@r[
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setVertexBuffer(UINT slot, const D3D12_VERTEX_BUFFER_VIEW& view) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CfbNXobt@̐ݒ𔻒肷
+     * @param	view	CfbNXobt@r[
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setIndexBuffer(const D3D12_INDEX_BUFFER_VIEW& view) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	v~eBu`̐ݒ𔻒肷
+     * @param	topology	v~eBu`
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY topology) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	r[|[g̐ݒ𔻒肷
+     * @param	viewport	r[|[g
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setViewport(const D3D12_VIEWPORT& viewport) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	VU[`̐ݒ𔻒肷
+     * @param	rect	VU[`
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setScissorRect(const D3D12_RECT& rect) noexcept;
+
+private:
+    static constexpr UINT rootParameterMax_ = 16;  /// L^郋[gp[^̍ő吔
+    static constexpr UINT vertexSlotMax_ = 4;      /// L^钸_obt@̓̓Xbg̍ő吔
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[g̎
+     */
+    enum class RootArgumentType {
+        None,             /// ݒ
+        DescriptorTable,  /// fBXNv^e[u
+        ShaderResource,   /// [g SRV
+        Constant,         /// [g萔
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[g
+     */
+    struct RootArgument {
+        RootArgumentType type{};   /// 
+        UINT64           value{};  /// ݒl
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	lrċL^XVAv𐔂
+     * @param	same	L^ς݂̒lƓ
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool update(bool same) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[g̐ݒ𔻒肷
+     * @param	index	[gp[^ԍ
+     * @param	type	
+     * @param	value	ݒl
+     * @return	ĂяoKvȂ true
+     */
+    [[nodiscard]] bool setRootArgument(UINT index, RootArgumentType type, UINT64 value) noexcept;
+
+private:
+    ID3D12PipelineState*                                 pipelineState_{};      /// pCvCXe[g
+    ID3D12RootSignature*                                 rootSignature_{};      /// [gVOl`
+    ID3D12DescriptorHeap*                                descriptorHeap_{};     /// fBXNv^q[v
+    std::array<RootArgument, rootParameterMax_>          rootArguments_{};      /// [g
+    std::array<D3D12_VERTEX_BUFFER_VIEW, vertexSlotMax_> vertexBuffers_{};      /// _obt@r[
+    std::array<bool, vertexSlotMax_>                     vertexBufferValid_{};  /// _obt@r[L^ς݂
+    D3D12_INDEX_BUFFER_VIEW                              indexBuffer_{};        /// CfbNXobt@r[
+    bool                                                 indexBufferValid_{};   /// CfbNXobt@r[L^ς݂
+    D3D_PRIMITIVE_TOPOLOGY                               topology_{};           /// v~eBu`(ݒ UNDEFINED)
+    D3D12_VIEWPORT                                       viewport_{};           /// r[|[g
+    bool                                                 viewportValid_{};      /// r[|[gL^ς݂
+    D3D12_RECT                                           scissorRect_{};        /// VU[`
+    bool                                                 scissorRectValid_{};   /// VU[`L^ς݂
+    Stats                                                stats_{};              /// v
+};
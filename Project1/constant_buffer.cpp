@@ -1,6 +1,7 @@
 // RX^gobt@NX
 
 #include "constant_buffer.h"
+#include "deferred_release.h"
 #include <cassert>
 
 namespace {
@@ -12,26 +13,39 @@ namespace {
  * @brief    fXgN^
  */
 ConstantBuffer::~ConstantBuffer() {
+    if (constantBuffer_ && mapped_) {
+        constantBuffer_->Unmap(0, nullptr);
+    }
+    // GPU QƂĂ\̂ŁAt[̊҂Ă
+    DeferredRelease::instance().release(std::move(constantBuffer_));
+
     // fBXNv^q[v̉Kv
-    DescriptorHeapContainer::instance().releaseDescriptor(heapType_, descriptorIndex_);
+    // 쐬ĂȂꍇ̓fBXNv^mۂĂȂ
+    if (descriptorCount_ > 0) {
+        DescriptorHeapContainer::instance().releaseDescriptorRange(heapType_, descriptorIndex_, descriptorCount_);
+    }
 }
 
 //---------------------------------------------------------------------------------
 /**
  * @brief	RX^gobt@̍쐬
  * @param	bufferSize		RX^gobt@̃TCY
+ * @param	frameCount		t[(t[ɗ̈mۂ)
  * @return	̐
  */
-[[nodiscard]] bool ConstantBuffer::create(UINT bufferSize) noexcept {
+[[nodiscard]] bool ConstantBuffer::create(UINT bufferSize, UINT frameCount) noexcept {
+    assert(frameCount > 0 && "t[sł");
+
     // ACgς݃TCY̌vZ
-    const auto size = (sizeof(bufferSize) + 255) & ~255;
+    sliceSize_ = (bufferSize + 255) & ~255;
 
     // obt@\[X̍쐬
+    // t[̗̈1̃\[Xɂ܂Ƃ߂
     D3D12_HEAP_PROPERTIES heapProps{};
     heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
     D3D12_RESOURCE_DESC resourceDesc{};
     resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    resourceDesc.Width = size;
+    resourceDesc.Width = UINT64(sliceSize_) * frameCount;
     resourceDesc.Height = 1;
     resourceDesc.DepthOrArraySize = 1;
     resourceDesc.MipLevels = 1;
@@ -39,7 +53,7 @@ ConstantBuffer::~ConstantBuffer() {
     resourceDesc.SampleDesc.Count = 1;
     resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
 
-    const auto res = Device::instance().get()->CreateCommittedResource(
+    auto res = Device::instance().get()->CreateCommittedResource(
         &heapProps,
         D3D12_HEAP_FLAG_NONE,
         &resourceDesc,
@@ -51,38 +65,34 @@ ConstantBuffer::~ConstantBuffer() {
         return false;
     }
 
-    // r[̍쐬
-    const auto descriptorIndex = DescriptorHeapContainer::instance().allocateDescriptor(heapType_);
+    // t[ނ̂Ń}bv܂܂ɂ
+    res = constantBuffer_->Map(0, nullptr, reinterpret_cast<void**>(&mapped_));
+    if (FAILED(res)) {
+        assert(false && "RX^gobt@̃}bvɎs܂");
+        return false;
+    }
+
+    // t[̃fBXNv^AĊm
+    const auto descriptorIndex = DescriptorHeapContainer::instance().allocateDescriptorRange(heapType_, frameCount);
     if (!descriptorIndex.has_value()) {
         assert(false && "RX^gobt@̃fBXNv^mۂɎs܂");
         return false;
     }
-
     // fBXNv^CfbNXۑ
     descriptorIndex_ = descriptorIndex.value();
-    // q[v擾
-    auto heap = DescriptorHeapContainer::instance().get(heapType_);
-
-    // RX^gobt@r[̐ݒ
-    D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc{};
-    cbvDesc.BufferLocation = constantBuffer_->GetGPUVirtualAddress();
-    cbvDesc.SizeInBytes = size;
-
-    // fBXNv^̃TCY擾
-    UINT cbvDescriptorSize = Device::instance().get()->GetDescriptorHandleIncrementSize(heapType_);
-
-    // fBXNv^q[v̊Jnnh擾
-    D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle = heap->GetCPUDescriptorHandleForHeapStart();
-    // w肳ꂽCfbNXnhi߂
-    cpuHandle.ptr += descriptorIndex_ * cbvDescriptorSize;
-
-    // RX^gobt@r[ƃnh֘At
-    Device::instance().get()->CreateConstantBufferView(&cbvDesc, cpuHandle);
-
-    // GPU pfBXNv^nhۑ
-    gpuHandle_ = heap->GetGPUDescriptorHandleForHeapStart();
-    // w肳ꂽCfbNXnhi߂
-    gpuHandle_.ptr += descriptorIndex_ * cbvDescriptorSize;
+    descriptorCount_ = frameCount;
+
+    // t[Ƀr[쐬
+    for (UINT frame = 0; frame < frameCount; ++frame) {
+        // RX^gobt@r[̐ݒ
+        D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc{};
+        cbvDesc.BufferLocation = constantBuffer_->GetGPUVirtualAddress() + UINT64(sliceSize_) * frame;
+        cbvDesc.SizeInBytes = sliceSize_;
+
+        // RX^gobt@r[ƃnh֘At
+        const auto cpuHandle = DescriptorHeapContainer::instance().cpuHandle(heapType_, descriptorIndex_ + frame);
+        Device::instance().get()->CreateConstantBufferView(&cbvDesc, cpuHandle);
+    }
 
     return true;
 }
@@ -97,12 +107,28 @@ ConstantBuffer::~ConstantBuffer() {
     return constantBuffer_.Get();
 }
 
+//---------------------------------------------------------------------------------
+/**
+ * @brief	t[̏ݐ擾
+ * obt@͏Ƀ}bv܂܂ɂ
+ * @param	frameIndex	t[CfbNX
+ * @return	ݐ̃AhX
+ */
+[[nodiscard]] std::byte* ConstantBuffer::mappedData(UINT frameIndex) const noexcept {
+    assert(mapped_ && "RX^gobt@쐬ł");
+    assert(frameIndex < descriptorCount_ && "t[CfbNXsł");
+    return mapped_ + UINT64(sliceSize_) * frameIndex;
+}
+
 //---------------------------------------------------------------------------------
 /**
  * @brief	GPU pfBXNv^nh擾
+ * @param	frameIndex	t[CfbNX
  * @return	GPU pfBXNv^nh
  */
-[[nodiscard]] D3D12_GPU_DESCRIPTOR_HANDLE ConstantBuffer::getGpuDescriptorHandle() const noexcept {
+[[nodiscard]] D3D12_GPU_DESCRIPTOR_HANDLE ConstantBuffer::getGpuDescriptorHandle(UINT frameIndex) const noexcept {
     assert(constantBuffer_ && "RX^gobt@쐬ł");
-    return gpuHandle_;
-}
\ No newline at end of file
+    assert(frameIndex < descriptorCount_ && "t[CfbNXsł");
+    // q[v̊gŕς邱Ƃ̂Ŗ擾
+    return DescriptorHeapContainer::instance().gpuHandle(heapType_, descriptorIndex_ + frameIndex);
+}
@@ -4,10 +4,13 @@
 
 #include "device.h"
 #include "descriptor_heap.h"
+#include <cstddef>
 
 //---------------------------------------------------------------------------------
 /**
  * @brief	RX^gobt@NX
+ * ɏɂȂ蓾t[ɗ̈ƃfBXNv^A
+ * Ot[ GPU ǂłԂɏ㏑Ȃ悤ɂ
  */
 class ConstantBuffer final {
 public:
@@ -27,9 +30,10 @@ public:
     /**
      * @brief	RX^gobt@̍쐬
      * @param	bufferSize		RX^gobt@̃TCY
+     * @param	frameCount		t[(t[ɗ̈mۂ)
      * @return	̐
      */
-    [[nodiscard]] bool create(UINT bufferSize) noexcept;
+    [[nodiscard]] bool create(UINT bufferSize, UINT frameCount = 1) noexcept;
 
     //---------------------------------------------------------------------------------
     /**
@@ -38,15 +42,27 @@ public:
      */
     [[nodiscard]] ID3D12Resource* constantBuffer() const noexcept;
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	t[̏ݐ擾
+     * obt@͏Ƀ}bv܂܂ɂ
+     * @param	frameIndex	t[CfbNX
+     * @return	ݐ̃AhX
+     */
+    [[nodiscard]] std::byte* mappedData(UINT frameIndex) const noexcept;
+
     //---------------------------------------------------------------------------------
     /**
      * @brief	GPU pfBXNv^nh擾
+     * @param	frameIndex	t[CfbNX
      * @return	GPU pfBXNv^nh
      */
-    [[nodiscard]] D3D12_GPU_DESCRIPTOR_HANDLE getGpuDescriptorHandle() const noexcept;
+    [[nodiscard]] D3D12_GPU_DESCRIPTOR_HANDLE getGpuDescriptorHandle(UINT frameIndex = 0) const noexcept;
 
 private:
-    Microsoft::WRL::ComPtr<ID3D12Resource> constantBuffer_{};   /// RX^gobt@
-    UINT                                   descriptorIndex_{};  /// fBXNv^CfbNX
-    D3D12_GPU_DESCRIPTOR_HANDLE            gpuHandle_{};        /// GPU pfBXNv^nh
+    Microsoft::WRL::ComPtr<ID3D12Resource> constantBuffer_{};   /// RX^gobt@(St[)
+    std::byte*                             mapped_{};           /// }bvAhX
+    UINT                                   sliceSize_{};        /// 1t[̃TCY
+    UINT                                   descriptorIndex_{};  /// 擪t[̃fBXNv^CfbNX
+    UINT                                   descriptorCount_{};  /// fBXNv^(t[)
 };
@@ -0,0 +1,109 @@
+// xL[NX
+
+#include "deferred_release.h"
+#include "descriptor_heap.h"
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[X̉\񂷂
+ * @param	object	IuWFNg
+ */
+void DeferredRelease::release(Microsoft::WRL::ComPtr<ID3D12Pageable> object) noexcept {
+    if (!object) {
+        return;
+    }
+
+    Entry entry{};
+    entry.object = std::move(object);
+    current_.emplace_back(std::move(entry));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	AfBXNv^̉\񂷂
+ * @param	type			fBXNv^q[ṽ^Cv
+ * @param	descriptorIndex	擪̃fBXNv^CfbNX
+ * @param	count			fBXNv^̐
+ */
+void DeferredRelease::release(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex, UINT count) noexcept {
+    if (count == 0) {
+        return;
+    }
+
+    Entry entry{};
+    entry.type = type;
+    entry.descriptorIndex = descriptorIndex;
+    entry.count = count;
+    current_.emplace_back(std::move(entry));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	GPU ̏t[ŉ\񂳂ꂽ̂
+ * @param	completedFenceValue	tFXl
+ */
+void DeferredRelease::retire(UINT64 completedFenceValue) noexcept {
+    while (!queue_.empty() && queue_.front().fenceValue <= completedFenceValue) {
+        execute(queue_.front());
+        queue_.pop_front();
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	t[ɉ\񂳂ꂽ̂tFXlƊ֘At
+ * @param	fenceValue	t[̃R}hXg̊ɃVOitFXl
+ */
+void DeferredRelease::endFrame(UINT64 fenceValue) noexcept {
+    for (auto& entry : current_) {
+        entry.fenceValue = fenceValue;
+        queue_.emplace_back(std::move(entry));
+    }
+    current_.clear();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Sĉ
+ * GPU ̏SĊĂĂяo
+ */
+void DeferredRelease::flush() noexcept {
+    for (auto& entry : queue_) {
+        execute(entry);
+    }
+    queue_.clear();
+    for (auto& entry : current_) {
+        execute(entry);
+    }
+    current_.clear();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	҂̃fBXNv^擾
+ * @param	type	fBXNv^q[ṽ^Cv
+ * @return	҂̃fBXNv^
+ */
+[[nodiscard]] UINT DeferredRelease::pendingDescriptorCount(D3D12_DESCRIPTOR_HEAP_TYPE type) const noexcept {
+    UINT count = 0;
+    for (const auto& entry : current_) {
+        count += (!entry.object && entry.type == type) ? entry.count : 0;
+    }
+    for (const auto& entry : queue_) {
+        count += (!entry.object && entry.type == type) ? entry.count : 0;
+    }
+    return count;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\s
+ * @param	entry	\
+ */
+void DeferredRelease::execute(Entry& entry) noexcept {
+    if (entry.object) {
+        entry.object.Reset();
+        return;
+    }
+    DescriptorHeapContainer::instance().freeDescriptorRange(entry.type, entry.descriptorIndex, entry.count);
+}
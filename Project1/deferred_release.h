@@ -0,0 +1,121 @@
+// xL[NX
+
+#pragma once
+
+#include "device.h"
+#include <deque>
+#include <vector>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	xL[NX
+ * GPU QƂĂ\̂郊\[XƃfBXNv^AŌɎgpt[̃tFXlƊ֘Atĕێ
+ * tFX̊mF_ŉ̂ŁÄ͂ɍėpł
+ * ȈՃVOgp^[ō쐬
+ */
+class DeferredRelease final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CX^X̎擾
+     * @return	CX^X̎Q
+     */
+    static DeferredRelease& instance() noexcept {
+        static DeferredRelease instance;
+        return instance;
+    }
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X̉\񂷂
+     * ID3D12Resource fBXNv^q[vȂ ID3D12Pageable ̔h󂯕t
+     * @param	object	IuWFNg
+     */
+    void release(Microsoft::WRL::ComPtr<ID3D12Pageable> object) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	AfBXNv^̉\񂷂
+     * @param	type			fBXNv^q[ṽ^Cv
+     * @param	descriptorIndex	擪̃fBXNv^CfbNX
+     * @param	count			fBXNv^̐
+     */
+    void release(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex, UINT count) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	GPU ̏t[ŉ\񂳂ꂽ̂
+     * @param	completedFenceValue	tFXl
+     */
+    void retire(UINT64 completedFenceValue) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	t[ɉ\񂳂ꂽ̂tFXlƊ֘At
+     * @param	fenceValue	t[̃R}hXg̊ɃVOitFXl
+     */
+    void endFrame(UINT64 fenceValue) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Sĉ
+     * GPU ̏SĊĂĂяo
+     */
+    void flush() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	҂̃fBXNv^擾
+     * @param	type	fBXNv^q[ṽ^Cv
+     * @return	҂̃fBXNv^
+     */
+    [[nodiscard]] UINT pendingDescriptorCount(D3D12_DESCRIPTOR_HEAP_TYPE type) const noexcept;
+
+private:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    DeferredRelease() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~DeferredRelease() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Rs[ƃ[ű֎~
+     */
+    DeferredRelease(const DeferredRelease&) = delete;
+    DeferredRelease& operator=(const DeferredRelease&) = delete;
+    DeferredRelease(DeferredRelease&&) = delete;
+    DeferredRelease& operator=(DeferredRelease&&) = delete;
+
+private:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\
+     * object ̏ꍇ̓fBXNv^̉\
+     */
+    struct Entry {
+        UINT64                                 fenceValue{};       /// ɃVOitFXl
+        Microsoft::WRL::ComPtr<ID3D12Pageable> object{};           /// IuWFNg
+        D3D12_DESCRIPTOR_HEAP_TYPE             type{};             /// fBXNv^q[ṽ^Cv
+        UINT                                   descriptorIndex{};  /// 擪̃fBXNv^CfbNX
+        UINT                                   count{};            /// fBXNv^̐
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\s
+     * @param	entry	\
+     */
+    static void execute(Entry& entry) noexcept;
+
+private:
+    std::vector<Entry> current_{};  /// t[̉\(tFXlݒ)
+    std::deque<Entry>  queue_{};    /// GPU ̏҂̉\(tFXl)
+};
@@ -2,12 +2,17 @@
 
 #include "descriptor_heap.h"
 #include "device.h"
+#include "deferred_release.h"
+#include <algorithm>
 #include <cassert>
+#include <vector>
 #include <wrl/client.h>
 
 //---------------------------------------------------------------------------------
 /**
  * @brief	fBXNv^q[vNX
+ * 傫̃y[WKvɉĒǉ
+ * CfbNX́uy[Wԍ * y[WTCY + y[Ẅʒuvŕ\
  */
 class DescriptorHeap final {
 public:
@@ -28,48 +33,44 @@ public:
     /**
      * @brief	fBXNv^q[v𐶐
      * @param	type			fBXNv^q[ṽ^Cv
-     * @param	numDescriptors	fBXNv^̐
+     * @param	numDescriptors	1y[W̃fBXNv^̐
      * @param	shaderVisible	VF[_[ANZX\ǂ
      * @return	̐
      */
     [[nodiscard]] bool create(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT numDescriptors, bool shaderVisible = false) noexcept {
-        // q[v̐ݒ
-        D3D12_DESCRIPTOR_HEAP_DESC heapDesc{};
-        heapDesc.Type = type;
-        heapDesc.NumDescriptors = numDescriptors;
-        heapDesc.Flags = shaderVisible ? D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE : D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
-
         type_ = type;  // q[ṽ^Cvۑ
+        pageSize_ = numDescriptors;
+        shaderVisible_ = shaderVisible;
+        descriptorSize_ = Device::instance().get()->GetDescriptorHandleIncrementSize(type);
 
-        // fBXNv^q[v̐
-        HRESULT hr = Device::instance().get()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&heap_));
-        if (FAILED(hr)) {
-            assert(false && "fBXNv^q[v̐Ɏs܂");
-            return false;
-        }
-
-        // SfBXNv^t[Xgɓo^
-        maxDescriptorCount_ = numDescriptors;
-        for (UINT i = 0; i < maxDescriptorCount_; ++i) {
-            freeIndices_.push_back(i);
-        }
-
-        return true;
+        return addPage();
     }
 
     //---------------------------------------------------------------------------------
     /**
-     * @brief	\񂳂ĂfBXNv^
+     * @brief	쐬r[VF[_[q[v֔f
      */
-    void applyPendingFree() noexcept {
-        if (pendingFreeIndices_.empty()) {
+    void commit() noexcept {
+        if (!shaderVisible_) {
             return;
         }
 
-        for (auto i : pendingFreeIndices_) {
-            freeIndices_.push_back(i);
+        auto device = Device::instance().get();
+        if (dirtyAll_) {
+            // q[v蒼ꍇ͑Sy[W𔽉f
+            for (UINT page = 0; page < static_cast<UINT>(pages_.size()); ++page) {
+                device->CopyDescriptorsSimple(pageSize_, offsetHandle(gpuHeap_->GetCPUDescriptorHandleForHeapStart(), page * pageSize_),
+                    pages_[page].heap_->GetCPUDescriptorHandleForHeapStart(), type_);
+            }
+        }
+        else {
+            for (const auto& range : dirty_) {
+                device->CopyDescriptorsSimple(range.count, offsetHandle(gpuHeap_->GetCPUDescriptorHandleForHeapStart(), range.begin),
+                    cpuHandle(range.begin), type_);
+            }
         }
-        pendingFreeIndices_.clear();
+        dirtyAll_ = false;
+        dirty_.clear();
     }
 
     //---------------------------------------------------------------------------------
@@ -78,10 +79,11 @@ public:
      * @return	fBXNv^q[ṽ|C^
      */
     [[nodiscard]] ID3D12DescriptorHeap* get() const noexcept {
-        if (!heap_) {
+        if (pages_.empty()) {
             assert(false && "fBXNv^q[vł");
+            return nullptr;
         }
-        return heap_.Get();
+        return shaderVisible_ ? gpuHeap_.Get() : pages_.front().heap_.Get();
     }
 
     //---------------------------------------------------------------------------------
@@ -90,7 +92,7 @@ public:
      * @return	fBXNv^q[ṽ^Cv
      */
     [[nodiscard]] D3D12_DESCRIPTOR_HEAP_TYPE getType() const noexcept {
-        if (!heap_) {
+        if (pages_.empty()) {
             assert(false && "fBXNv^q[vł");
         }
         return type_;
@@ -98,33 +100,233 @@ public:
 
     //---------------------------------------------------------------------------------
     /**
-     * @brief	fBXNv^mۂ
+     * @brief	AfBXNv^mۂ
+     * @param	count	mۂ鐔
+     * @return	mۂ擪̃fBXNv^CfbNX
      */
-    [[nodiscard]] std::optional<UINT> allocateDescriptor() noexcept {
-        if (freeIndices_.empty()) {
+    [[nodiscard]] std::optional<UINT> allocateDescriptor(UINT count = 1) noexcept {
+        if (count == 0 || count > pageSize_) {
+            assert(false && "1y[WɎ܂Ȃ̃fBXNv^͊mۂł܂");
             return std::nullopt;
         }
-        const auto index = freeIndices_.back();
-        freeIndices_.pop_back();
-        return index;
+
+        // 擪̃y[W珇ɁA܂ŏ̋󂫗̈g
+        for (UINT page = 0; page < static_cast<UINT>(pages_.size()); ++page) {
+            if (auto index = allocateFromPage(page, count)) {
+                return index;
+            }
+        }
+
+        // 󂫂΃y[Wǉ
+        if (!addPage()) {
+            return std::nullopt;
+        }
+        return allocateFromPage(static_cast<UINT>(pages_.size()) - 1, count);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	fBXNv^󂫗֖̈߂
+     * GPU ̎QƂȂĂĂяo
+     * @param	descriptorIndex	擪̃fBXNv^CfbNX
+     * @param	count			fBXNv^̐
+     */
+    void freeDescriptor(UINT descriptorIndex, UINT count = 1) noexcept {
+        if (descriptorIndex / pageSize_ >= pages_.size()) {
+            assert(false && "fBXNv^CfbNXsł");
+            return;
+        }
+        freeRange({ descriptorIndex, count });
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	r[쐬p CPU fBXNv^nh擾
+     * @param	descriptorIndex	fBXNv^CfbNX
+     * @return	CPU fBXNv^nh
+     */
+    [[nodiscard]] D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle(UINT descriptorIndex) const noexcept {
+        const auto& page = pages_[descriptorIndex / pageSize_];
+        return offsetHandle(page.heap_->GetCPUDescriptorHandleForHeapStart(), descriptorIndex % pageSize_);
     }
 
     //---------------------------------------------------------------------------------
     /**
-     * @brief	\̃fBXNv^o^
+     * @brief	GPU fBXNv^nh擾
+     * @param	descriptorIndex	fBXNv^CfbNX
+     * @return	GPU fBXNv^nh
      */
-    void releaseDescriptor(UINT descriptorIndex) noexcept {
-        // 10 t[ɊJ悤o^
-        pendingFreeIndices_.push_back(descriptorIndex);
+    [[nodiscard]] D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle(UINT descriptorIndex) const noexcept {
+        if (!shaderVisible_) {
+            assert(false && "VF[_[ł͂Ȃq[vł");
+            return {};
+        }
+        D3D12_GPU_DESCRIPTOR_HANDLE handle = gpuHeap_->GetGPUDescriptorHandleForHeapStart();
+        handle.ptr += UINT64(descriptorIndex) * descriptorSize_;
+        return handle;
     }
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	gp󋵂擾
+     * @return	gp
+     */
+    [[nodiscard]] DescriptorHeapStats stats() const noexcept {
+        DescriptorHeapStats stats{};
+        stats.pageCount = static_cast<UINT>(pages_.size());
+        stats.capacity = stats.pageCount * pageSize_;
+        UINT freeCount = 0;
+        for (const auto& page : pages_) {
+            for (const auto& range : page.freeRanges_) {
+                freeCount += range.count;
+                stats.largestFreeRange = (std::max)(stats.largestFreeRange, range.count);
+            }
+            stats.freeRangeCount += static_cast<UINT>(page.freeRanges_.size());
+        }
+        stats.pending = DeferredRelease::instance().pendingDescriptorCount(type_);
+        stats.used = stats.capacity - freeCount;
+        return stats;
+    }
 
 private:
-    Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> heap_{};                /// fBXNv^q[v
-    D3D12_DESCRIPTOR_HEAP_TYPE                   type_{};                /// q[ṽ^Cv
-    UINT                                         maxDescriptorCount_{};  /// őfBXNv^
-    std::vector<UINT>                            freeIndices_{};         /// 󂫃fBXNv^CfbNX̃Xg
-    std::vector<UINT>                            pendingFreeIndices_{};  /// ҂fBXNv^CfbNX̃Xg
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	fBXNv^͈̔
+     */
+    struct Range {
+        UINT begin{};  /// 擪̃CfbNX
+        UINT count{};  /// 
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	y[W
+     */
+    struct Page {
+        Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> heap_{};        /// y[W̃q[v(VF[_[̏ꍇ CPU ̍쐬p)
+        std::vector<Range>                           freeRanges_{};  /// 󂫗̈(y[Ẅʒu)
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	nhfBXNv^i߂
+     */
+    [[nodiscard]] D3D12_CPU_DESCRIPTOR_HANDLE offsetHandle(D3D12_CPU_DESCRIPTOR_HANDLE handle, UINT count) const noexcept {
+        handle.ptr += SIZE_T(count) * descriptorSize_;
+        return handle;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	y[Wǉ
+     * @return	ǉ̐
+     */
+    [[nodiscard]] bool addPage() noexcept {
+        // y[Ŵ̓VF[_[QƂȂ̂ CPU ̃q[vƂč쐬
+        D3D12_DESCRIPTOR_HEAP_DESC heapDesc{};
+        heapDesc.Type = type_;
+        heapDesc.NumDescriptors = pageSize_;
+        heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+
+        Page page{};
+        HRESULT hr = Device::instance().get()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&page.heap_));
+        if (FAILED(hr)) {
+            assert(false && "fBXNv^q[v̐Ɏs܂");
+            return false;
+        }
+        // y[WŜ󂫗̈Ƃēo^
+        page.freeRanges_.push_back({ 0, pageSize_ });
+        pages_.emplace_back(std::move(page));
+
+        if (!shaderVisible_) {
+            return true;
+        }
+
+        // VF[_[q[vSy[W̑傫ō蒼
+        heapDesc.NumDescriptors = pageSize_ * static_cast<UINT>(pages_.size());
+        heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+        Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> heap{};
+        hr = Device::instance().get()->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&heap));
+        if (FAILED(hr)) {
+            assert(false && "VF[_[fBXNv^q[v̐Ɏs܂");
+            pages_.pop_back();
+            return false;
+        }
+        // 蒼Õq[v GPU gIĂ
+        if (gpuHeap_) {
+            DeferredRelease::instance().release(std::move(gpuHeap_));
+        }
+        gpuHeap_ = std::move(heap);
+        dirtyAll_ = true;
+
+        return true;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	y[WAfBXNv^mۂ
+     * @param	page	y[Wԍ
+     * @param	count	mۂ鐔
+     * @return	mۂ擪̃fBXNv^CfbNX
+     */
+    [[nodiscard]] std::optional<UINT> allocateFromPage(UINT page, UINT count) noexcept {
+        auto& ranges = pages_[page].freeRanges_;
+        auto it = std::find_if(ranges.begin(), ranges.end(), [count](const Range& range) { return range.count >= count; });
+        if (it == ranges.end()) {
+            return std::nullopt;
+        }
+
+        const UINT index = page * pageSize_ + it->begin;
+        it->begin += count;
+        it->count -= count;
+        if (it->count == 0) {
+            ranges.erase(it);
+        }
+
+        if (shaderVisible_) {
+            dirty_.push_back({ index, count });
+        }
+        return index;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	͈͂󂫗֖̈߂
+     * אڂ󂫗̈Ƃ͌
+     * @param	range	͈
+     */
+    void freeRange(const Range& range) noexcept {
+        auto& ranges = pages_[range.begin / pageSize_].freeRanges_;
+        const Range local{ range.begin % pageSize_, range.count };
+
+        auto next = std::lower_bound(ranges.begin(), ranges.end(), local.begin,
+            [](const Range& r, UINT begin) { return r.begin < begin; });
+        auto it = ranges.insert(next, local);
+
+        // ̋󂫗̈ƌ
+        if (auto after = it + 1; after != ranges.end() && it->begin + it->count == after->begin) {
+            it->count += after->count;
+            ranges.erase(after);
+        }
+        // Ő󂫗̈ƌ
+        if (it != ranges.begin()) {
+            auto before = it - 1;
+            if (before->begin + before->count == it->begin) {
+                before->count += it->count;
+                ranges.erase(it);
+            }
+        }
+    }
+
+private:
+    D3D12_DESCRIPTOR_HEAP_TYPE                   type_{};            /// q[ṽ^Cv
+    UINT                                         pageSize_{};        /// 1y[W̃fBXNv^
+    UINT                                         descriptorSize_{};  /// fBXNv^̃TCY
+    bool                                         shaderVisible_{};   /// VF[_[ANZX\ǂ
+    std::vector<Page>                            pages_{};           /// y[W
+    Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> gpuHeap_{};         /// Sy[W̃VF[_[q[v
+    std::vector<Range>                           dirty_{};           /// VF[_[q[v֖f͈̔
+    bool                                         dirtyAll_{};        /// Sy[W𔽉fKv邩
 };
 
 //---------------------------------------------------------------------------------
@@ -156,20 +358,21 @@ DescriptorHeapContainer::~DescriptorHeapContainer() {
     }
 
     auto p = std::make_unique<DescriptorHeap>();
-    if (p->create(type, numDescriptors, shaderVisible)) {
-        map_.emplace(type, std::move(p));
+    if (!p->create(type, numDescriptors, shaderVisible)) {
+        return false;
     }
+    map_.emplace(type, std::move(p));
 
     return true;
 }
 
 //---------------------------------------------------------------------------------
 /**
- * @brief	\񂳂ĂfBXNv^
+ * @brief	쐬r[VF[_[q[v֔f
  */
-void DescriptorHeapContainer::applyPendingFree() noexcept {
+void DescriptorHeapContainer::commit() noexcept {
     for (auto& [key, p] : map_) {
-        p->applyPendingFree();
+        p->commit();
     }
 }
 
@@ -205,16 +408,107 @@ void DescriptorHeapContainer::applyPendingFree() noexcept {
     return it->second->allocateDescriptor();
 }
 
+//---------------------------------------------------------------------------------
+/**
+ * @brief	AfBXNv^mۂ
+ * @param	type	^Cv
+ * @param	count	mۂ鐔
+ * @return	mۂ擪̃fBXNv^CfbNX
+ */
+[[nodiscard]] std::optional<UINT> DescriptorHeapContainer::allocateDescriptorRange(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT count) noexcept {
+    const auto it = map_.find(type);
+    if (it == map_.end()) {
+        assert(false && "fBXNv^q[v܂");
+        return std::nullopt;
+    }
+
+    return it->second->allocateDescriptor(count);
+}
+
 //---------------------------------------------------------------------------------
 /**
  * @brief	J\̃fBXNv^o^
  * @param	tyep ^Cv
  */
 void DescriptorHeapContainer::releaseDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex) noexcept {
+    releaseDescriptorRange(type, descriptorIndex, 1);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	J\̘AfBXNv^o^
+ * t[̃R}hXg̊҂Ă󂫗֖̈߂
+ * @param	type			^Cv
+ * @param	descriptorIndex	擪̃fBXNv^CfbNX
+ * @param	count			fBXNv^̐
+ */
+void DescriptorHeapContainer::releaseDescriptorRange(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex, UINT count) noexcept {
+    DeferredRelease::instance().release(type, descriptorIndex, count);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	AfBXNv^󂫗֖̈߂
+ * @param	type			^Cv
+ * @param	descriptorIndex	擪̃fBXNv^CfbNX
+ * @param	count			fBXNv^̐
+ */
+void DescriptorHeapContainer::freeDescriptorRange(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex, UINT count) noexcept {
+    const auto it = map_.find(type);
+    if (it == map_.end()) {
+        // IŃq[vɔjꂽꍇ
+        return;
+    }
+
+    it->second->freeDescriptor(descriptorIndex, count);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	r[쐬p CPU fBXNv^nh擾
+ * @param	type			^Cv
+ * @param	descriptorIndex	fBXNv^CfbNX
+ * @return	CPU fBXNv^nh
+ */
+[[nodiscard]] D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeapContainer::cpuHandle(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex) const noexcept {
+    const auto it = map_.find(type);
+    if (it == map_.end()) {
+        assert(false && "fBXNv^q[v܂");
+        return {};
+    }
+
+    return it->second->cpuHandle(descriptorIndex);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	GPU fBXNv^nh擾
+ * @param	type			^Cv
+ * @param	descriptorIndex	fBXNv^CfbNX
+ * @return	GPU fBXNv^nh
+ */
+[[nodiscard]] D3D12_GPU_DESCRIPTOR_HANDLE DescriptorHeapContainer::gpuHandle(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex) const noexcept {
+    const auto it = map_.find(type);
+    if (it == map_.end()) {
+        assert(false && "fBXNv^q[v܂");
+        return {};
+    }
+
+    return it->second->gpuHandle(descriptorIndex);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	gp󋵂擾
+ * @param	type	^Cv
+ * @return	gp
+ */
+[[nodiscard]] DescriptorHeapStats DescriptorHeapContainer::stats(D3D12_DESCRIPTOR_HEAP_TYPE type) const noexcept {
     const auto it = map_.find(type);
     if (it == map_.end()) {
         assert(false && "fBXNv^q[v܂");
+        return {};
     }
 
-    return it->second->releaseDescriptor(descriptorIndex);
+    return it->second->stats();
 }
\ No newline at end of file
@@ -9,9 +9,43 @@
 
 class DescriptorHeap;  /// O錾
 
+//---------------------------------------------------------------------------------
+/**
+ * @brief	fBXNv^q[v̎gp
+ */
+struct DescriptorHeapStats {
+    UINT capacity{};          /// fBXNv^
+    UINT used{};              /// gp̃fBXNv^(҂܂)
+    UINT pending{};           /// ҂̃fBXNv^
+    UINT pageCount{};         /// y[W
+    UINT freeRangeCount{};    /// A󂫗̈̐
+    UINT largestFreeRange{};  /// ő̘A󂫗̈̃fBXNv^
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	L擾
+     * @return	gp̃fBXNv^̊(0`1)
+     */
+    [[nodiscard]] float occupancy() const noexcept {
+        return capacity == 0 ? 0.0f : static_cast<float>(used) / static_cast<float>(capacity);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	fЉ擾
+     * @return	󂫗̈̂ő̘ÄɊ܂܂Ȃ(0`1)
+     */
+    [[nodiscard]] float fragmentation() const noexcept {
+        const UINT freeCount = capacity - used;
+        return freeCount == 0 ? 0.0f : 1.0f - static_cast<float>(largestFreeRange) / static_cast<float>(freeCount);
+    }
+};
+
 //---------------------------------------------------------------------------------
 /**
  * @brief	fBXNv^q[vNX
+ * fBXNv^̓y[WPʂŊmۂAȂȂy[Wǉ
+ * VF[_[q[v CPU ̃y[Wɍ쐬r[Sy[W̑傫̃q[v֔f
  * ȈՃVOgp^[ō쐬
  */
 class DescriptorHeapContainer final {
@@ -30,7 +64,7 @@ public:
     /**
      * @brief	fBXNv^q[v𐶐
      * @param	type			fBXNv^q[ṽ^Cv
-     * @param	numDescriptors	fBXNv^̐
+     * @param	numDescriptors	1y[W̃fBXNv^̐(z肷gp猈߂)
      * @param	shaderVisible	VF[_[ANZX\ǂ
      * @return	̐
      */
@@ -38,13 +72,16 @@ public:
 
     //---------------------------------------------------------------------------------
     /**
-     * @brief	\񂳂ĂfBXNv^
+     * @brief	쐬r[VF[_[q[v֔f
+     * fBXNv^q[vR}hXgɐݒ肷OɌĂяo
      */
-    void applyPendingFree() noexcept;
+    void commit() noexcept;
 
     //---------------------------------------------------------------------------------
     /**
      * @brief	fBXNv^q[v擾
+     * VF[_[q[v͑Sy[W̃q[vAȊO͐擪y[W̃q[vԂ
+     * y[W̒ǉŕς邱Ƃ̂ŕێȂ
      * @param	tyep ^Cv
      * @return	fBXNv^q[ṽ|C^
      */
@@ -58,13 +95,70 @@ public:
      */
     [[nodiscard]] std::optional<UINT> allocateDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE type) noexcept;
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	AfBXNv^mۂ
+     * fBXNv^e[upɁAy[WŘA͈͂mۂ
+     * @param	type	^Cv
+     * @param	count	mۂ鐔(1y[W̃fBXNv^ȉ)
+     * @return	mۂ擪̃fBXNv^CfbNX
+     */
+    [[nodiscard]] std::optional<UINT> allocateDescriptorRange(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT count) noexcept;
+
     //---------------------------------------------------------------------------------
     /**
      * @brief	J\̃fBXNv^o^
+     * GPU ̏Ăėp
      * @param	tyep ^Cv
      */
     void releaseDescriptor(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex) noexcept;
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	J\̘AfBXNv^o^
+     * @param	type			^Cv
+     * @param	descriptorIndex	擪̃fBXNv^CfbNX
+     * @param	count			fBXNv^̐
+     */
+    void releaseDescriptorRange(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex, UINT count) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	AfBXNv^󂫗֖̈߂
+     * xL[ GPU ̏̊ɌĂяo
+     * @param	type			^Cv
+     * @param	descriptorIndex	擪̃fBXNv^CfbNX
+     * @param	count			fBXNv^̐
+     */
+    void freeDescriptorRange(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex, UINT count) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	r[쐬p CPU fBXNv^nh擾
+     * @param	type			^Cv
+     * @param	descriptorIndex	fBXNv^CfbNX
+     * @return	CPU fBXNv^nh
+     */
+    [[nodiscard]] D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	GPU fBXNv^nh擾
+     * y[W̒ǉŕς邱Ƃ̂ŁA`R}h̐ݒ莞Ɏ擾邱
+     * @param	type			^Cv
+     * @param	descriptorIndex	fBXNv^CfbNX
+     * @return	GPU fBXNv^nh
+     */
+    [[nodiscard]] D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptorIndex) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	gp󋵂擾
+     * @param	type	^Cv
+     * @return	gp
+     */
+    [[nodiscard]] DescriptorHeapStats stats(D3D12_DESCRIPTOR_HEAP_TYPE type) const noexcept;
+
 private:
     //---------------------------------------------------------------------------------
     /**
@@ -0,0 +1,158 @@
+// `pPbgL[NX
+
+#include "draw_queue.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace {
+    constexpr UINT   depthBits_ = 24;                               // [x̃rbg
+    constexpr UINT64 depthMax_ = (UINT64{ 1 } << depthBits_) - 1;  // ʎq[x̍ől
+
+    constexpr UINT passShift_ = 60;         // pẌʒu
+    constexpr UINT transparentShift_ = 59;  // tÖʒu
+
+    constexpr UINT opaquePsoShift_ = 51;    // s PSO ԍ̈ʒu
+    constexpr UINT opaqueShapeShift_ = 35;  // š`ԍ̈ʒu
+    constexpr UINT opaqueDepthShift_ = 11;  // s̐[ẍʒu
+
+    constexpr UINT transparentDepthShift_ = 35;  // ̐[ẍʒu
+    constexpr UINT transparentPsoShift_ = 27;    //  PSO ԍ̈ʒu
+    constexpr UINT transparentShapeShift_ = 11;  // ̌`ԍ̈ʒu
+
+    constexpr UINT radixBits_ = 8;                  // \[g1̃rbg
+    constexpr UINT radixSize_ = 1u << radixBits_;   // \[g1̎蓾l̐
+    constexpr UINT radixPasses_ = 64 / radixBits_;  // \[ǧ
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[gL[쐬
+ * @param	pass		pXԍ(passMax )
+ * @param	transparent	ǂ
+ * @param	pso			PSO ԍ(psoMax )
+ * @param	shape		`ԍ(shapeMax )
+ * @param	depth		J̐[x(0`1 ɐKlA͈͊O͊ۂ߂)
+ * @return	\[gL[
+ */
+[[nodiscard]] UINT64 DrawQueue::makeKey(UINT pass, bool transparent, UINT pso, UINT shape, float depth) noexcept {
+    assert(pass < passMax && pso < psoMax && shape < shapeMax && "\[gL[͈̔͊Oł");
+
+    // NaN  0 Ɋۂ߂
+    const float  clamped = depth > 0.0f ? (std::min)(depth, 1.0f) : 0.0f;
+    const UINT64 quantized = static_cast<UINT64>(clamped * static_cast<float>(depthMax_));
+
+    UINT64 key = UINT64(pass) << passShift_;
+    if (!transparent) {
+        key |= UINT64(pso) << opaquePsoShift_;
+        key |= UINT64(shape) << opaqueShapeShift_;
+        key |= quantized << opaqueDepthShift_;
+        return key;
+    }
+
+    // ͉`悷̂Ő[x𔽓]
+    key |= UINT64{ 1 } << transparentShift_;
+    key |= (depthMax_ - quantized) << transparentDepthShift_;
+    key |= UINT64(pso) << transparentPsoShift_;
+    key |= UINT64(shape) << transparentShapeShift_;
+    return key;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[gL[[xXe[g̃L[擾
+ * @param	key	\[gL[
+ * @return	Xe[g̃L[
+ */
+[[nodiscard]] UINT64 DrawQueue::stateKey(UINT64 key) noexcept {
+    const UINT shift = (key >> transparentShift_) & 1 ? transparentDepthShift_ : opaqueDepthShift_;
+    return key & ~(depthMax_ << shift);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[gL[ PSO ԍ擾
+ * @param	key	\[gL[
+ * @return	PSO ԍ
+ */
+[[nodiscard]] UINT DrawQueue::pso(UINT64 key) noexcept {
+    const UINT shift = (key >> transparentShift_) & 1 ? transparentPsoShift_ : opaquePsoShift_;
+    return static_cast<UINT>(key >> shift) & (psoMax - 1);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	pPbgSč폜
+ */
+void DrawQueue::clear() noexcept {
+    packets_.clear();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	pPbgǉ
+ * @param	key		\[gL[
+ * @param	index	`Ώۂ̔ԍ
+ */
+void DrawQueue::push(UINT64 key, UINT32 index) noexcept {
+    packets_.push_back({ key, index });
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[gL[̏ɕבւ
+ * 8 rbg LSD \[g()BSpPbgŒl͔΂
+ */
+void DrawQueue::sort() noexcept {
+    const size_t count = packets_.size();
+    if (count < 2) {
+        return;
+    }
+    scratch_.resize(count);
+
+    // S̃qXgO1̑ō
+    std::array<std::array<UINT32, radixSize_>, radixPasses_> histograms{};
+    for (const auto& packet : packets_) {
+        for (UINT pass = 0; pass < radixPasses_; ++pass) {
+            ++histograms[pass][(packet.key >> (pass * radixBits_)) & (radixSize_ - 1)];
+        }
+    }
+
+    auto* src = packets_.data();
+    auto* dst = scratch_.data();
+    for (UINT pass = 0; pass < radixPasses_; ++pass) {
+        auto& histogram = histograms[pass];
+        const UINT shift = pass * radixBits_;
+
+        // SpPbgľ͕тςȂ̂Ŕ΂
+        if (histogram[(src[0].key >> shift) & (radixSize_ - 1)] == count) {
+            continue;
+        }
+
+        // qXgO݈ʒuɕϊ
+        UINT32 offset = 0;
+        for (auto& bucket : histogram) {
+            const UINT32 n = bucket;
+            bucket = offset;
+            offset += n;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            dst[histogram[(src[i].key >> shift) & (radixSize_ - 1)]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    // Ɨ̈摤Ɍʂꍇ͓ւ
+    if (src != packets_.data()) {
+        packets_.swap(scratch_);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	pPbg擾
+ * @return	pPbg(sort ͕`揇)
+ */
+[[nodiscard]] const std::vector<DrawPacket>& DrawQueue::packets() const noexcept {
+    return packets_;
+}
@@ -0,0 +1,107 @@
+// `pPbgL[NX
+
+#pragma once
+
+#include <Windows.h>
+#include <vector>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`pPbg
+ */
+struct DrawPacket {
+    UINT64 key{};    /// \[gL[
+    UINT32 index{};  /// `Ώۂ̔ԍ(L[̗p߂)
+};
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`pPbgL[NX
+ * 64 rbg̃\[gL[pPbgς݁A\[gŕ`揇ɕׂ
+ *
+ * \[gL[̃rbgzu(ʂ)
+ * s		: pX(4) | 0(1) | PSO(8) | `(16) | [x(24, O) | gp(11)
+ * 		: pX(4) | 1(1) | [x(24, ) | PSO(8) | `(16) | gp(11)
+ * s̓Xe[g̐؂ւȂȂ鏇A͐ł鏇ɕ
+ */
+class DrawQueue final {
+public:
+    static constexpr UINT passMax = 1u << 4;    /// pX̍ő吔
+    static constexpr UINT psoMax = 1u << 8;     /// PSO ԍ̍ő吔
+    static constexpr UINT shapeMax = 1u << 16;  /// `ԍ̍ő吔
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    DrawQueue() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~DrawQueue() = default;
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[gL[쐬
+     * @param	pass		pXԍ(passMax )
+     * @param	transparent	ǂ
+     * @param	pso			PSO ԍ(psoMax )
+     * @param	shape		`ԍ(shapeMax )
+     * @param	depth		J̐[x(0`1 ɐKlA͈͊O͊ۂ߂)
+     * @return	\[gL[
+     */
+    [[nodiscard]] static UINT64 makeKey(UINT pass, bool transparent, UINT pso, UINT shape, float depth) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[gL[[xXe[g̃L[擾
+     * lApPbg1̕`R}hɂ܂Ƃ߂
+     * @param	key	\[gL[
+     * @return	Xe[g̃L[
+     */
+    [[nodiscard]] static UINT64 stateKey(UINT64 key) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[gL[ PSO ԍ擾
+     * @param	key	\[gL[
+     * @return	PSO ԍ
+     */
+    [[nodiscard]] static UINT pso(UINT64 key) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pPbgSč폜
+     */
+    void clear() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pPbgǉ
+     * @param	key		\[gL[
+     * @param	index	`Ώۂ̔ԍ
+     */
+    void push(UINT64 key, UINT32 index) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[gL[̏ɕבւ
+     * 8 rbg LSD \[g()BSpPbgŒl͔΂
+     */
+    void sort() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pPbg擾
+     * @return	pPbg(sort ͕`揇)
+     */
+    [[nodiscard]] const std::vector<DrawPacket>& packets() const noexcept;
+
+private:
+    std::vector<DrawPacket> packets_{};  /// pPbg
+    std::vector<DrawPacket> scratch_{};  /// \[g̍Ɨ̈
+};
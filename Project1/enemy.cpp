@@ -14,6 +14,9 @@ namespace game {
 
         auto triId = ShapeContainer::instance().create<TrianglePolygon>();
         set({ 0.0f, 0.0f, 30.0f }, { 0.0f, 0.0f, 0.0f }, { 10.0f, 10.0f, 1.0f }, { 1.0f, 1.0f, 1.0f, 1 }, triId);
+        setCollision(CollisionLayer::Enemy, {});
+        // 傫̂Ō̃IuWFNgBՕɂ
+        setOccluder(true);
     }
 
     //---------------------------------------------------------------------------------
@@ -26,9 +29,10 @@ namespace game {
 
     //---------------------------------------------------------------------------------
     /**
-     * @brief	qbg̏
+     * @brief	qbgn߂̏
+     * @param	other	Փˑ̃IuWFNgnh
      */
-    void Enemy::onHit() noexcept {
+    void Enemy::onHitEnter([[maybe_unused]] UINT64 other) noexcept {
         color_.y *= 0.95f;
         color_.z *= 0.95f;
     }
@@ -40,8 +40,9 @@ namespace game {
     public:
         //---------------------------------------------------------------------------------
         /**
-         * @brief	qbg̏
+         * @brief	qbgn߂̏
+         * @param	other	Փˑ̃IuWFNgnh
          */
-        virtual void onHit() noexcept override;
+        virtual void onHitEnter(UINT64 other) noexcept override;
     };
 }  // namespace game
\ No newline at end of file
@@ -15,12 +15,18 @@
 #include "root_signature.h"
 #include "shader.h"
 #include "pipline_state_object.h"
+#include "command_signature.h"
 #include "constant_buffer.h"
 #include "depth_buffer.h"
+#include "upload_ring.h"
+#include "upload_manager.h"
+#include "deferred_release.h"
+#include "render_graph.h"
 
 #include "triangle_polygon.h"
 #include "quad_polygon.h"
 #include "shape_container.h"
+#include "software_renderer.h"
 
 #include "object.h"
 #include "camera.h"
@@ -31,9 +37,16 @@
 #include <memory>
 #include <vector>
 #include <cassert>
+#include <cstdio>
 
 namespace {
-    constexpr UINT sceneShaderSlot_ = 0;  // V[ʗpVF[_[Xbg
+    constexpr const char* windowName_ = "MyApp";  // EBhE
+    constexpr UINT64      statsInterval_ = 60;    // v^Cgɕ\t[̊Ԋu
+
+    constexpr UINT   sceneShaderSlot_ = RootSignature::sceneParameterIndex;  // V[ʗpVF[_[Xbg
+    constexpr UINT64 uploadRingSize_ = 4 * 1024 * 1024;                      // t[̃Abv[hf[^pobt@̃TCY
+    constexpr UINT   cbvSrvUavPageSize_ = 1024;                              // CBV/SRV/UAV fBXNv^q[v1y[W̃fBXNv^
+    constexpr UINT64 stagingSize_ = 8 * 1024 * 1024;                         // Rs[L[œ]f[^̃Xe[WÖ̃TCY
 }  // namespace
 
 class Application final {
@@ -57,7 +70,7 @@ public:
      */
     [[nodiscard]] bool initialize(HINSTANCE instance) noexcept {
         // EBhE̐
-        if (S_OK != Window::instance().create(instance, 1280, 720, "MyApp")) {
+        if (S_OK != Window::instance().create(instance, 1280, 720, windowName_)) {
             assert(false && "EBhE̐Ɏs܂");
             return false;
         }
@@ -87,7 +100,8 @@ public:
         }
 
         // 萔obt@pfBXNv^q[v̐
-        if (!DescriptorHeapContainer::instance().create(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 5, true)) {
+        // ȂȂꍇ̓y[WǉĊg
+        if (!DescriptorHeapContainer::instance().create(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, cbvSrvUavPageSize_, true)) {
             assert(false && "萔obt@pfBXNv^q[v̍쐬Ɏs܂");
             return false;
         }
@@ -111,13 +125,11 @@ public:
         }
 
         // R}hAP[^̐
-        if (!commandAllocatorInstance_[0].create(D3D12_COMMAND_LIST_TYPE_DIRECT)) {
-            assert(false && "R}hAP[^̍쐬Ɏs܂");
-            return false;
-        }
-        if (!commandAllocatorInstance_[1].create(D3D12_COMMAND_LIST_TYPE_DIRECT)) {
-            assert(false && "R}hAP[^̍쐬Ɏs܂");
-            return false;
+        for (auto& commandAllocator : commandAllocatorInstance_) {
+            if (!commandAllocator.create(D3D12_COMMAND_LIST_TYPE_DIRECT)) {
+                assert(false && "R}hAP[^̍쐬Ɏs܂");
+                return false;
+            }
         }
 
         // R}hXg̐
@@ -126,6 +138,12 @@ public:
             return false;
         }
 
+        // obNobt@ƃfvXobt@̃Xe[g̓R}hXgǐՂăoA𒣂
+        for (UINT i = 0; i < SwapChain::bufferCount; ++i) {
+            commandListInstance_.trackResource(renderTargetInstance_.get(i), D3D12_RESOURCE_STATE_PRESENT);
+        }
+        commandListInstance_.trackResource(depthBufferInstance_.depthBuffer(), D3D12_RESOURCE_STATE_DEPTH_WRITE);
+
         // tFX̐
         if (!fenceInstance_.create()) {
             assert(false && "tFX̍쐬Ɏs܂");
@@ -133,25 +151,50 @@ public:
         }
 
         // [gVOl`̐
-        if (!rootSignatureInstance_.create()) {
+        // CX^Xf[^͈k`ŃXgN`[hobt@ɒuēn
+        if (!rootSignatureInstance_.create(RootSignature::InstanceBinding::StructuredBuffer, RootSignature::InstanceFormat::Compact)) {
             assert(false && "[gVOl`̍쐬Ɏs܂");
             return false;
         }
         // VF[_[̐
-        if (!shaderInstance_.create()) {
+        // CX^Xf[^̓͂̓[gVOl`ɁA_̓͂͌`̒_tH[}bgɍ킹
+        if (!shaderInstance_.create(rootSignatureInstance_, VertexFormat::compact())) {
             assert(false && "VF[_[̍쐬Ɏs܂");
             return false;
         }
         // pCvCXe[gIuWFNg̐
-        if (!piplineStateObjectInstance_.create(shaderInstance_, rootSignatureInstance_)) {
+        if (!piplineStateObjectInstance_.create(shaderInstance_, rootSignatureInstance_, VertexFormat::compact())) {
             assert(false && "pCvCXe[gIuWFNg̍쐬Ɏs܂");
             return false;
         }
+        // p͐[x܂Ȃ
+        if (!transparentPiplineStateObjectInstance_.create(shaderInstance_, rootSignatureInstance_, VertexFormat::compact(), false)) {
+            assert(false && "p̃pCvCXe[gIuWFNg̍쐬Ɏs܂");
+            return false;
+        }
+        // R}hVOl`̐
+        // IuWFNg̕`܂Ƃ߂ ExecuteIndirect ŕ`悷
+        if (!commandSignatureInstance_.create(rootSignatureInstance_)) {
+            assert(false && "R}hVOl`̍쐬Ɏs܂");
+            return false;
+        }
 
         // J̍쐬
         camera_ = std::make_unique<game::Camera>();
         camera_->initialize();
 
+        // t[̃Abv[hf[^pOobt@̍쐬
+        if (!UploadRing::instance().create(uploadRingSize_)) {
+            assert(false && "Abv[hOobt@̍쐬Ɏs܂");
+            return false;
+        }
+
+        // `Ȃǂ̃f[^ftHgq[v֓]Rs[L[̍쐬
+        if (!UploadManager::instance().create(stagingSize_)) {
+            assert(false && "Abv[hǗ̍쐬Ɏs܂");
+            return false;
+        }
+
         // Q[IuWFNg̐
         game::GameObjectManager::instance().createObject<game::Player>();
         game::GameObjectManager::instance().createObject<game::Enemy>();
@@ -179,6 +222,11 @@ public:
 
             // `揈 /////////////////////////////////////////////////////////////////////////
 
+            // ǉꂽ`̃f[^Rs[L[ŋLobt@֓]
+            // ]͕`ƕsčsA`󂩂`悳
+            ShapeContainer::instance().commit();
+            UploadManager::instance().submit();
+
             // ݂̃obNobt@CfbNX擾
             const auto backBufferIndex = swapChainInstance_.get()->GetCurrentBackBufferIndex();
 
@@ -187,73 +235,96 @@ public:
                 fenceInstance_.wait(frameFenceValue_[backBufferIndex]);
             }
 
-            // fBXNv^q[v̉\񕪂
-            DescriptorHeapContainer::instance().applyPendingFree();
+            // GPU ̏t[ŉ\񂳂ꂽ\[XƃfBXNv^
+            const auto completedFenceValue = fenceInstance_.completedValue();
+            DeferredRelease::instance().retire(completedFenceValue);
+
+            // GPU ̏t[̃Abv[ḧ
+            UploadRing::instance().retire(completedFenceValue);
 
             // R}hAP[^Zbg
             commandAllocatorInstance_[backBufferIndex].reset();
             // R}hXgZbg
             commandListInstance_.reset(commandAllocatorInstance_[backBufferIndex]);
 
-            // \[XoAŃ_[^[Qbg Present  RenderTarget ֕ύX
-            auto pToRT = resourceBarrier(renderTargetInstance_.get(backBufferIndex), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_RENDER_TARGET);
-            commandListInstance_.get()->ResourceBarrier(1, &pToRT);
+            // ZbgOɕۑꂽÕt[̓v\
+            if (nextFenceValue_ % statsInterval_ == 0) {
+                showFrameStats();
+            }
 
-            // _[^[Qbg̐ݒ
-            D3D12_CPU_DESCRIPTOR_HANDLE handles[] = { renderTargetInstance_.getCpuDescriptorHandle(backBufferIndex) };
-            // fvXobt@̃nhݒ
-            D3D12_CPU_DESCRIPTOR_HANDLE depthHandle = depthBufferInstance_.getCpuDescriptorHandle();
-            commandListInstance_.get()->OMSetRenderTargets(1, handles, false, &depthHandle);
+            // t[̃_[Ot\z
+            // oAƃ_[^[Qbg̐ݒENA̓_[Ots
+            renderGraph_.reset();
+            const auto backBuffer = renderGraph_.importResource("BackBuffer", renderTargetInstance_.get(backBufferIndex), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT, true);
+            const auto depthBuffer = renderGraph_.importResource("DepthBuffer", depthBufferInstance_.depthBuffer(), D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_DEPTH_WRITE);
 
-            // _[^[Qbg̃NA
+            // CpX
             const float clearColor[] = { 0.2f, 0.2f, 0.2f, 1.0f };  // NA
-            commandListInstance_.get()->ClearRenderTargetView(handles[0], clearColor, 0, nullptr);
-            // fvXobt@̃NA
-            commandListInstance_.get()->ClearDepthStencilView(depthHandle, D3D12_CLEAR_FLAG_DEPTH, 1.0f, 0, 0, nullptr);
-
-            // [gVOl`̐ݒ
-            commandListInstance_.get()->SetGraphicsRootSignature(rootSignatureInstance_.get());
-
-            // r[|[g̐ݒ
-            const auto [w, h] = Window::instance().size();
-            D3D12_VIEWPORT viewport{};
-            viewport.TopLeftX = 0.0f;
-            viewport.TopLeftY = 0.0f;
-            viewport.Width = static_cast<float>(w);
-            viewport.Height = static_cast<float>(h);
-            viewport.MinDepth = 0.0f;
-            viewport.MaxDepth = 1.0f;
-            commandListInstance_.get()->RSSetViewports(1, &viewport);
-
-            // VU[`̐ݒ
-            D3D12_RECT scissorRect{};
-            scissorRect.left = 0;
-            scissorRect.top = 0;
-            scissorRect.right = w;
-            scissorRect.bottom = h;
-            commandListInstance_.get()->RSSetScissorRects(1, &scissorRect);
-
-            // RX^gobt@pfBXNv^q[v̐ݒ
-            ID3D12DescriptorHeap* p[] = { DescriptorHeapContainer::instance().get(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV) };
-            commandListInstance_.get()->SetDescriptorHeaps(1, p);
-
-            // pCvCXe[g̐ݒ
-            commandListInstance_.get()->SetPipelineState(piplineStateObjectInstance_.get());
-
-            // J̃RX^gobt@փf[^]
-            camera_->updateDrawBuffer();
-            camera_->setDrawCommand(commandListInstance_, sceneShaderSlot_);
-
-            // Q[IuWFNg̕`
-            game::GameObjectManager::instance().draw(commandListInstance_);
-
-            //-------------------------------------------------
-
-            // \[XoAŃ_[^[Qbg RenderTarget  Present ֕ύX
-            auto rtToP = resourceBarrier(renderTargetInstance_.get(backBufferIndex), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT);
-            commandListInstance_.get()->ResourceBarrier(1, &rtToP);
-
-            // R}hXgN[Y
+            auto mainPass = renderGraph_.addPass("Main", [this, backBufferIndex](const CommandList& commandList, const RenderGraph&) {
+                // [gVOl`̐ݒ
+                commandList.setGraphicsRootSignature(rootSignatureInstance_.get());
+
+                // r[|[g̐ݒ
+                const auto [w, h] = Window::instance().size();
+                D3D12_VIEWPORT viewport{};
+                viewport.TopLeftX = 0.0f;
+                viewport.TopLeftY = 0.0f;
+                viewport.Width = static_cast<float>(w);
+                viewport.Height = static_cast<float>(h);
+                viewport.MinDepth = 0.0f;
+                viewport.MaxDepth = 1.0f;
+                commandList.setViewport(viewport);
+
+                // VU[`̐ݒ
+                D3D12_RECT scissorRect{};
+                scissorRect.left = 0;
+                scissorRect.top = 0;
+                scissorRect.right = w;
+                scissorRect.bottom = h;
+                commandList.setScissorRect(scissorRect);
+
+                // RX^gobt@pfBXNv^q[v̐ݒ
+                // t[ɍ쐬r[𔽉fĂݒ肷
+                DescriptorHeapContainer::instance().commit();
+                commandList.setDescriptorHeap(DescriptorHeapContainer::instance().get(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
+
+                // J̃RX^gobt@փf[^]
+                // ̃t[p̗̈֏݁Ä̗̃fBXNv^ݒ肷
+                camera_->updateDrawBuffer(backBufferIndex);
+                camera_->setDrawCommand(commandList, sceneShaderSlot_, backBufferIndex);
+
+                // Q[IuWFNg̕`
+                // pCvCXe[g͕sƔŐ؂ւĐݒ肳
+                game::GameObjectManager::instance().draw(commandList, rootSignatureInstance_, piplineStateObjectInstance_, transparentPiplineStateObjectInstance_, *camera_,
+                    &commandSignatureInstance_);
+            });
+            mainPass.renderTarget(backBuffer, renderTargetInstance_.getCpuDescriptorHandle(backBufferIndex), clearColor)
+                .depthStencil(depthBuffer, depthBufferInstance_.getCpuDescriptorHandle(), true, 1.0f);
+
+            // F12 œt[ CPU ŕ`悵ĎQƉ摜Ƃďo
+            if (Input::instance().getTrigger(VK_F12)) {
+                const auto [w, h] = Window::instance().size();
+                SoftwareRenderer renderer;
+                // `̕ 4 ̔{ɐ؂艺
+                if (renderer.create(static_cast<UINT>(w) & ~3u, static_cast<UINT>(h))) {
+                    renderer.clear(clearColor);
+                    game::GameObjectManager::instance().drawSoftware(renderer, rootSignatureInstance_, *camera_);
+                    renderer.resolve();
+                    if (!renderer.writePpm("capture.ppm")) {
+                        assert(false && "QƉ摜̏oɎs܂");
+                    }
+                }
+            }
+
+            // oA߂ăR}hXgɋL^
+            if (renderGraph_.compile()) {
+                if (!renderGraph_.execute(commandListInstance_)) {
+                    assert(false && "_[Ot̎sɎs܂");
+                }
+            }
+
+            // cĂoA𔭍sĂR}hXgN[Y
+            commandListInstance_.flushBarriers();
             commandListInstance_.get()->Close();
 
             // R}hL[ɃR}hXg𑗐M
@@ -266,49 +337,57 @@ public:
             // tFXɃtFXlݒ
             commandQueueInstance_.get()->Signal(fenceInstance_.get(), nextFenceValue_);
             frameFenceValue_[backBufferIndex] = nextFenceValue_;
+            // t[̃Abv[ḧ͂̃tFXl̊܂Ŏgp
+            UploadRing::instance().endFrame(nextFenceValue_);
+            // t[ɉ\񂳂ꂽ̂l
+            DeferredRelease::instance().endFrame(nextFenceValue_);
             nextFenceValue_++;
         }
 
         // [v𔲂ƃEBhE
         game::GameObjectManager::instance().clear();
+        camera_.reset();
+
+        // GPU ̏SĊ̂҂Ăc
+        if (nextFenceValue_ > 1) {
+            fenceInstance_.wait(nextFenceValue_ - 1);
+        }
+        UploadManager::instance().flush();
+        DeferredRelease::instance().flush();
 
     }
 
+private:
     //---------------------------------------------------------------------------------
     /**
-     * @brief	\[XɃoAݒ肷
-     * @param	commandList	R}hXg
-     * @param	resource	oA𒣂郊\[X
-     * @param	from		ύXÕ\[XXe[g
-     * @param	to			ύX̃\[XXe[g
+     * @brief	OL^t[̓vEBhẼ^Cgɕ\
      */
-    D3D12_RESOURCE_BARRIER resourceBarrier(ID3D12Resource* resource, D3D12_RESOURCE_STATES from, D3D12_RESOURCE_STATES to) noexcept {
-        D3D12_RESOURCE_BARRIER barrier{};
-        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-        barrier.Transition.pResource = resource;
-        barrier.Transition.StateBefore = from;
-        barrier.Transition.StateAfter = to;
-        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-
-        return barrier;
+    void showFrameStats() const noexcept {
+        const auto& stats = commandListInstance_.previousFrameStats();
+        char        title[192]{};
+        std::snprintf(title, sizeof(title), "%s - state %u issued / %u eliminated, barrier %u issued / %u eliminated in %u flushes", windowName_,
+            stats.state.issued, stats.state.eliminated, stats.barrier.issued, stats.barrier.eliminated, stats.barrier.flushes);
+        Window::instance().setTitle(title);
     }
 
 private:
-    CommandQueue     commandQueueInstance_{};         /// R}hL[CX^X
-    SwapChain        swapChainInstance_{};            /// Xbv`FCCX^X
-    RenderTarget     renderTargetInstance_{};         /// _[^[QbgCX^X
-    DepthBuffer      depthBufferInstance_{};          /// fvXobt@CX^X
-    CommandAllocator commandAllocatorInstance_[2]{};  /// R}hAP[^CX^X
-    CommandList      commandListInstance_{};          /// R}hXgCX^X
-
-    Fence  fenceInstance_{};       /// tFXCX^X
-    UINT64 frameFenceValue_[2]{};  /// ݂̃t[̃tFXl
-    UINT64 nextFenceValue_ = 1;    /// ̃t[̃tFXl
-
-    RootSignature      rootSignatureInstance_{};       /// [gVOl`CX^X
-    Shader             shaderInstance_{};              /// VF[_[CX^X
-    PiplineStateObject piplineStateObjectInstance_{};  /// pCvCXe[gIuWFNgCX^X
+    CommandQueue     commandQueueInstance_{};                              /// R}hL[CX^X
+    SwapChain        swapChainInstance_{};                                 /// Xbv`FCCX^X
+    RenderTarget     renderTargetInstance_{};                              /// _[^[QbgCX^X
+    DepthBuffer      depthBufferInstance_{};                               /// fvXobt@CX^X
+    CommandAllocator commandAllocatorInstance_[SwapChain::bufferCount]{};  /// R}hAP[^CX^X
+    CommandList      commandListInstance_{};                               /// R}hXgCX^X
+    RenderGraph      renderGraph_{};                                       /// t[̃_[Ot
+
+    Fence  fenceInstance_{};                            /// tFXCX^X
+    UINT64 frameFenceValue_[SwapChain::bufferCount]{};  /// ݂̃t[̃tFXl
+    UINT64 nextFenceValue_ = 1;                         /// ̃t[̃tFXl
+
+    RootSignature      rootSignatureInstance_{};                  /// [gVOl`CX^X
+    Shader             shaderInstance_{};                         /// VF[_[CX^X
+    PiplineStateObject piplineStateObjectInstance_{};             /// pCvCXe[gIuWFNgCX^X
+    PiplineStateObject transparentPiplineStateObjectInstance_{};  /// p̃pCvCXe[gIuWFNgCX^X
+    CommandSignature   commandSignatureInstance_{};               /// R}hVOl`CX^X
 
     std::unique_ptr<game::Camera> camera_{};  /// J
 };
@@ -43,6 +43,19 @@ void Fence::wait(UINT64 fenceValue) const noexcept {
 	}
 }
 
+//---------------------------------------------------------------------------------
+/**
+ * @brief	GPU tFXl擾
+ * @return	tFXl
+ */
+[[nodiscard]] UINT64 Fence::completedValue() const noexcept {
+	if (!fence_) {
+		assert(false && "tFX쐬ł");
+		return 0;
+	}
+	return fence_->GetCompletedValue();
+}
+
 //---------------------------------------------------------------------------------
 /**
  * @brief	tFX擾
@@ -36,6 +36,13 @@ public:
      */
     void wait(UINT64 fenceValue) const noexcept;
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	GPU tFXl擾
+     * @return	tFXl
+     */
+    [[nodiscard]] UINT64 completedValue() const noexcept;
+
     //---------------------------------------------------------------------------------
     /**
      * @brief	tFX擾
@@ -0,0 +1,139 @@
+// JONX
+
+#include "frustum_culler.h"
+#include <algorithm>
+
+namespace game {
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ݒ肷
+     * sxNg(v * M)̍sȂ̂ŁAʂ͍s̗񂩂o
+     * vWFNV̐[x 0 ` 1 ͈̔͂Ƃ
+     * @param	viewProjection	r[sƃvWFNVsZs
+     */
+    void XM_CALLCONV FrustumCuller::setViewProjection(DirectX::FXMMATRIX viewProjection) noexcept {
+        using namespace DirectX;
+
+        // ]uƗ񂪍sɂȂ
+        const XMMATRIX columns = XMMatrixTranspose(viewProjection);
+        const XMVECTOR planes[planeCount_] = {
+            XMVectorAdd(columns.r[3], columns.r[0]),       // 
+            XMVectorSubtract(columns.r[3], columns.r[0]),  // E
+            XMVectorAdd(columns.r[3], columns.r[1]),       // 
+            XMVectorSubtract(columns.r[3], columns.r[1]),  // 
+            columns.r[2],                                  // 
+            XMVectorSubtract(columns.r[3], columns.r[2]),  // 
+        };
+
+        // rł悤ɖ@𐳋K
+        for (size_t i = 0; i < planeCount_; ++i) {
+            XMStoreFloat4(&planes_[i], XMPlaneNormalize(planes[i]));
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	o^ESč폜
+     */
+    void FrustumCuller::clear() noexcept {
+        centerX_.clear();
+        centerY_.clear();
+        centerZ_.clear();
+        radius_.clear();
+        count_ = 0;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Eo^
+     * @param	center	E̒S
+     * @param	radius	E̔a
+     */
+    void FrustumCuller::push(const DirectX::XMFLOAT3& center, float radius) noexcept {
+        //  batchSize Pʂœǂݍނ̂ŁA]̗vfmۂĂ
+        if (count_ % batchSize == 0) {
+            const size_t size = count_ + batchSize;
+            centerX_.resize(size);
+            centerY_.resize(size);
+            centerZ_.resize(size);
+            radius_.resize(size);
+        }
+
+        centerX_[count_] = center.x;
+        centerY_[count_] = center.y;
+        centerZ_[count_] = center.z;
+        radius_[count_] = radius;
+        ++count_;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ƏdȂ鋫E𔻒肷
+     * ʖɁAS܂ł̕t -a ȏォ 4 vf̃xNg 2 Ŕ肷
+     * @param	visible	dȂ鋫E̓o^̔ԍ̏ݐ(o^ɕ)
+     * @return	dȂ鋫E̐
+     */
+    size_t FrustumCuller::cull(std::vector<UINT>& visible) const noexcept {
+        using namespace DirectX;
+
+        visible.clear();
+        visible.reserve(count_);
+
+        // ʂ̊exNgɓWJĂ
+        XMVECTOR planeX[planeCount_];
+        XMVECTOR planeY[planeCount_];
+        XMVECTOR planeZ[planeCount_];
+        XMVECTOR planeW[planeCount_];
+        for (size_t i = 0; i < planeCount_; ++i) {
+            planeX[i] = XMVectorReplicate(planes_[i].x);
+            planeY[i] = XMVectorReplicate(planes_[i].y);
+            planeZ[i] = XMVectorReplicate(planes_[i].z);
+            planeW[i] = XMVectorReplicate(planes_[i].w);
+        }
+
+        auto load = [](const std::vector<float>& values, size_t index) {
+            return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(values.data() + index));
+        };
+
+        for (size_t base = 0; base < count_; base += batchSize) {
+            const XMVECTOR x[] = { load(centerX_, base), load(centerX_, base + 4) };
+            const XMVECTOR y[] = { load(centerY_, base), load(centerY_, base + 4) };
+            const XMVECTOR z[] = { load(centerZ_, base), load(centerZ_, base + 4) };
+            const XMVECTOR negativeRadius[] = { XMVectorNegate(load(radius_, base)), XMVectorNegate(load(radius_, base + 4)) };
+            XMVECTOR       inside[] = { XMVectorTrueInt(), XMVectorTrueInt() };
+
+            for (size_t i = 0; i < planeCount_; ++i) {
+                for (size_t j = 0; j < 2; ++j) {
+                    // ʂ璆S܂ł̕t
+                    XMVECTOR distance = XMVectorMultiplyAdd(x[j], planeX[i], planeW[i]);
+                    distance = XMVectorMultiplyAdd(y[j], planeY[i], distance);
+                    distance = XMVectorMultiplyAdd(z[j], planeZ[i], distance);
+                    inside[j] = XMVectorAndInt(inside[j], XMVectorGreaterOrEqual(distance, negativeRadius[j]));
+                }
+            }
+
+            // ʂ̃}XN猩vf̔ԍo(]̗vf͏)
+            uint32_t mask[batchSize];
+            XMStoreInt4(mask, inside[0]);
+            XMStoreInt4(mask + 4, inside[1]);
+            const size_t end = (std::min)(batchSize, count_ - base);
+            for (size_t i = 0; i < end; ++i) {
+                if (mask[i] != 0) {
+                    visible.push_back(static_cast<UINT>(base + i));
+                }
+            }
+        }
+
+        return visible.size();
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	o^E̐擾
+     * @return	E̐
+     */
+    [[nodiscard]] size_t FrustumCuller::size() const noexcept {
+        return count_;
+    }
+}  // namespace game
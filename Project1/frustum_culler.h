@@ -0,0 +1,82 @@
+// JONX
+
+#pragma once
+
+#include <Windows.h>
+#include <DirectXMath.h>
+#include <vector>
+
+namespace game {
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	JONX
+     * r[EvWFNVs񂩂6̕ʂoAo^E𔻒肷
+     * E͐̔zɊi[ASIMD  8 ܂Ƃ߂Ĕ肷
+     */
+    class FrustumCuller final {
+    public:
+        static constexpr size_t batchSize = 8;  /// 1̔ł܂Ƃ߂ď鋫E̐
+
+    public:
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief    RXgN^
+         */
+        FrustumCuller() = default;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief    fXgN^
+         */
+        ~FrustumCuller() = default;
+
+    public:
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ݒ肷
+         * @param	viewProjection	r[sƃvWFNVsZs
+         */
+        void XM_CALLCONV setViewProjection(DirectX::FXMMATRIX viewProjection) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	o^ESč폜
+         */
+        void clear() noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Eo^
+         * o^̔ԍ茋ʂ̃CfbNXɂȂ
+         * @param	center	E̒S
+         * @param	radius	E̔a
+         */
+        void push(const DirectX::XMFLOAT3& center, float radius) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ƏdȂ鋫E𔻒肷
+         * @param	visible	dȂ鋫E̓o^̔ԍ̏ݐ(o^ɕ)
+         * @return	dȂ鋫E̐
+         */
+        size_t cull(std::vector<UINT>& visible) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	o^E̐擾
+         * @return	E̐
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+    private:
+        static constexpr size_t planeCount_ = 6;  /// ̕ʂ̐
+
+        DirectX::XMFLOAT4  planes_[planeCount_]{};  /// ̕(@͓)
+        std::vector<float> centerX_{};              /// E̒S X (batchSize PʂŊmۂ)
+        std::vector<float> centerY_{};              /// E̒S Y 
+        std::vector<float> centerZ_{};              /// E̒S Z 
+        std::vector<float> radius_{};               /// E̔a
+        size_t             count_{};                /// o^E̐
+    };
+}  // namespace game
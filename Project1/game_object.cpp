@@ -2,19 +2,10 @@
 
 #include "game_object.h"
 #include "shape_container.h"
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 
-namespace {
-    //---------------------------------------------------------------------------------
-    /**
-     * @brief	Q[IuWFNgRX^gobt@pf[^\
-     */
-    struct ConstBufferData {
-        DirectX::XMMATRIX world_{};  /// [hs
-        DirectX::XMFLOAT4 color_{};  /// J[(RGBA)
-    };
-}  // namespace
-
 namespace game {
     //---------------------------------------------------------------------------------
     /**
@@ -24,35 +15,6 @@ namespace game {
         createDrawBuffer();
     }
 
-    //---------------------------------------------------------------------------------
-    /**
-     * @brief	`R}hݒ
-     * @param	commandList	R}hXg
-     * @param	slot		Xbgԍ
-     */
-    void GameObject::setDrawCommand(const CommandList& commandList, UINT slot) noexcept {
-        Object::setDrawCommand(commandList, slot);
-        ShapeContainer::instance().draw(commandList, shapeId_);
-    }
-
-    //---------------------------------------------------------------------------------
-    /**
-     * @brief	`pobt@̍쐬
-     */
-    void GameObject::createDrawBuffer() noexcept {
-        if (!constantBuffer_.create(sizeof(ConstBufferData))) {
-            assert(false && "GameObject RX^gobt@̍쐬Ɏs܂");
-        }
-    }
-
-    //---------------------------------------------------------------------------------
-    /**
-     * @brief	`pobt@̍XV
-     */
-    void GameObject::updateDrawBuffer() noexcept {
-        Object::updateConstantBuffer(ConstBufferData{ DirectX::XMMatrixTranspose(world_), color_ });
-    }
-
     //---------------------------------------------------------------------------------
     /**
      * @brief	IuWFNgnh̐ݒ
@@ -73,6 +35,17 @@ namespace game {
     }
 
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Փ˃C[̐ݒ
+     * @param	layer	Փ˃C[
+     * @param	mask	ՓˑΏۂƂՓ˃C[̃}XN
+     */
+    void GameObject::setCollision(CollisionLayer layer, CollisionMask mask) noexcept {
+        collisionLayer_ = layer;
+        collisionMask_ = mask;
+    }
+
     //---------------------------------------------------------------------------------
     /**
      * @brief	WƃJ[̐ݒ
@@ -83,6 +56,11 @@ namespace game {
      * @param	shapeId	`󎯕ʎq
      */
     void GameObject::set(DirectX::XMFLOAT3 pos, DirectX::XMFLOAT3 rot, DirectX::XMFLOAT3 scale, DirectX::XMFLOAT4 color, UINT64 shapeId) noexcept {
+        // p͈kCX^Xf[^pɕ`łێ
+        position_ = pos;
+        DirectX::XMStoreFloat4(&rotation_, DirectX::XMQuaternionRotationRollPitchYaw(rot.x, rot.y, rot.z));
+        scale_ = scale;
+
         // [hšvZ
         DirectX::XMMATRIX matScale = DirectX::XMMatrixScaling(scale.x, scale.y, scale.z);
         DirectX::XMMATRIX rotation = DirectX::XMMatrixRotationRollPitchYaw(rot.x, rot.y, rot.z);
@@ -94,8 +72,50 @@ namespace game {
         // `󎯕ʎq̐ݒ
         shapeId_ = shapeId;
 
-        // Փ˔p̔aݒ
-        radius_ = (scale.x + scale.y + scale.z) / (3.0f * 2.0f);
+        // `̋E{[擾
+        // `󂪌Ȃꍇ͒Pʗ̂ƂĈ
+        localBounds_ = ShapeContainer::instance().bounds(shapeId_).value_or(
+            Shape::Bounds{ { 0.0f, 0.0f, 0.0f }, 0.5f, { 0.0f, 0.0f, 0.0f }, { 0.5f, 0.5f, 0.5f } });
+        // _obt@̊i[l`̍W֖߂ϊ͕`掞ɃCX^X̕ϊ֊܂߂
+        positionRange_ = ShapeContainer::instance().positionRange(shapeId_).value_or(VertexFormat::PositionRange{});
+        updateBounds();
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	sړ
+     * @param	offset	ړ
+     */
+    void GameObject::translate(const DirectX::XMFLOAT3& offset) noexcept {
+        position_.x += offset.x;
+        position_.y += offset.y;
+        position_.z += offset.z;
+        world_.r[3] = DirectX::XMVectorAdd(world_.r[3], DirectX::XMVectorSet(offset.x, offset.y, offset.z, 0.0f));
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[hԂ̋E{[XV
+     */
+    void GameObject::updateBounds() noexcept {
+        using namespace DirectX;
+
+        // E͒SϊAa͍ő̎XP[Ŋg傷
+        const float maxScale = (std::max)({
+            XMVectorGetX(XMVector3Length(world_.r[0])),
+            XMVectorGetX(XMVector3Length(world_.r[1])),
+            XMVectorGetX(XMVector3Length(world_.r[2])) });
+        XMStoreFloat3(&worldBounds_.sphereCenter, XMVector3TransformCoord(XMLoadFloat3(&localBounds_.sphereCenter), world_));
+        worldBounds_.sphereRadius = localBounds_.sphereRadius * maxScale;
+
+        // AABB ͒SϊAe͉̒]EXP[̐Βlŕϊ
+        const XMVECTOR extents = XMLoadFloat3(&localBounds_.boxExtents);
+        const XMVECTOR worldExtents = XMVectorAdd(XMVectorAdd(
+            XMVectorMultiply(XMVectorSplatX(extents), XMVectorAbs(world_.r[0])),
+            XMVectorMultiply(XMVectorSplatY(extents), XMVectorAbs(world_.r[1]))),
+            XMVectorMultiply(XMVectorSplatZ(extents), XMVectorAbs(world_.r[2])));
+        XMStoreFloat3(&worldBounds_.boxCenter, XMVector3TransformCoord(XMLoadFloat3(&localBounds_.boxCenter), world_));
+        XMStoreFloat3(&worldBounds_.boxExtents, worldExtents);
     }
 
     //---------------------------------------------------------------------------------
@@ -107,6 +127,23 @@ namespace game {
         return world_;
     }
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`p̃[hs̎擾
+     * @return  `p̃[hs
+     */
+    [[nodiscard]] DirectX::XMMATRIX GameObject::instanceWorld() const noexcept {
+        using namespace DirectX;
+
+        // gƕsړ̍s|̂ƓʂAe̍s̊gƕsړ̍s̕ϊŋ߂
+        XMMATRIX result{};
+        result.r[0] = XMVectorScale(world_.r[0], positionRange_.scale.x);
+        result.r[1] = XMVectorScale(world_.r[1], positionRange_.scale.y);
+        result.r[2] = XMVectorScale(world_.r[2], positionRange_.scale.z);
+        result.r[3] = XMVector3Transform(XMLoadFloat3(&positionRange_.bias), world_);
+        return result;
+    }
+
     //---------------------------------------------------------------------------------
     /**
      * @brief	J[̎擾
@@ -115,4 +152,49 @@ namespace game {
     [[nodiscard]] DirectX::XMFLOAT4 GameObject::color() const noexcept {
         return color_;
     }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	kCX^X`pf[^̎擾
+     * ʒuE]Eg嗦͕ێĂl̂܂܎gA[hs͕Ȃ
+     * p set()  translate() ŕς邱ƁBworld_ 𒼐ڏƃfobOrhŌo
+     * W̊i[͈͂̊g͊g嗦ɁAsړ͉]Eg債ĈʒuɊ܂߂
+     * @return  CX^Xf[^
+     */
+    [[nodiscard]] CompactInstanceData GameObject::compactInstanceData() const noexcept {
+        using namespace DirectX;
+
+        XMVECTOR       scale = XMLoadFloat3(&scale_);
+        const XMVECTOR rotation = XMLoadFloat4(&rotation_);
+        XMVECTOR       translation = XMLoadFloat3(&position_);
+#if defined(_DEBUG)
+        {
+            // ێĂp[hsƈv邩AĊm߂
+            // g嗦 0 ̎Ɖ]܂Ȃ̂ŁȀꍇ͊m߂Ȃ
+            XMVECTOR       worldScale{};
+            XMVECTOR       worldRotation{};
+            XMVECTOR       worldTranslation{};
+            const XMVECTOR epsilon = XMVectorReplicate(1.0e-3f);
+            if (XMMatrixDecompose(&worldScale, &worldRotation, &worldTranslation, world_)) {
+                // q  -q ͓]\
+                const float dot = std::abs(XMVectorGetX(XMVector4Dot(worldRotation, rotation)));
+                assert(XMVector3NearEqual(worldScale, scale, epsilon) && XMVector3NearEqual(worldTranslation, translation, epsilon) &&
+                    dot > 1.0f - 1.0e-3f && "[hs񂪕ێĂpƈv܂");
+            }
+        }
+#endif
+
+        // i[l * rangeScale + rangeBias gE]Esړ̂
+        // g嗦 scale * rangeScaleAʒu rangeBias gE]Ĉʒuɉ_ɂȂ
+        const XMVECTOR bias = XMVectorMultiply(XMLoadFloat3(&positionRange_.bias), scale);
+        translation = XMVectorAdd(translation, XMVector3Rotate(bias, rotation));
+        scale = XMVectorMultiply(scale, XMLoadFloat3(&positionRange_.scale));
+
+        CompactInstanceData data{};
+        XMStoreFloat3(&data.position_, translation);
+        PackedVector::XMStoreUByteN4(&data.color_, XMLoadFloat4(&color_));
+        PackedVector::XMStoreShortN4(&data.rotation_, rotation);
+        PackedVector::XMStoreHalf4(&data.scale_, XMVectorSetW(scale, 0.0f));
+        return data;
+    }
 }  // namespace game
\ No newline at end of file
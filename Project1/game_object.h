@@ -3,7 +3,10 @@
 #pragma once
 
 #include <DirectXMath.h>
+#include <DirectXPackedVector.h>
 #include "object.h"
+#include "shape.h"
+#include "collision_layer.h"
 
 namespace game {
 
@@ -39,39 +42,81 @@ namespace game {
          */
         virtual void update() noexcept override {};
 
+    public:
         //---------------------------------------------------------------------------------
         /**
-         * @brief	`R}hݒ
-         * @param	commandList	R}hXg
-         * @param	slot		Xbgԍ
+         * @brief	`pobt@̍쐬
+         * `󖈂ɂ܂Ƃ߂ăCX^X`悷邽߁Aʂ̕`pobt@͎Ȃ
+         */
+        virtual void createDrawBuffer() noexcept override {};
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	`pobt@̍XV
+         * `󖈂ɂ܂Ƃ߂ăCX^X`悷邽߁Aʂ̕`pobt@͎Ȃ
+         * @param	frameIndex	t[CfbNX
          */
-        virtual void setDrawCommand(const CommandList& commandList, UINT slot) noexcept override;
+        virtual void updateDrawBuffer([[maybe_unused]] UINT frameIndex) noexcept override {};
+
 
     public:
         //---------------------------------------------------------------------------------
         /**
-         * @brief	`pobt@̍쐬
+         * @brief	qbgn߂̏
+         * @param	other	Փˑ̃IuWFNgnh
          */
-        virtual void createDrawBuffer() noexcept override;
+        virtual void onHitEnter([[maybe_unused]] UINT64 other) noexcept {};
 
         //---------------------------------------------------------------------------------
         /**
-         * @brief	`pobt@̍XV
+         * @brief	qbgĂ鎞̏
+         * @param	other	Փˑ̃IuWFNgnh
          */
-        virtual void updateDrawBuffer() noexcept override;
+        virtual void onHitStay([[maybe_unused]] UINT64 other) noexcept {};
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	qbgȈ
+         * @param	other	Փˑ̃IuWFNgnh
+         */
+        virtual void onHitExit([[maybe_unused]] UINT64 other) noexcept {};
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Փ˃C[̐ݒ
+         * @param	layer	Փ˃C[
+         * @param	mask	ՓˑΏۂƂՓ˃C[̃}XN
+         */
+        void setCollision(CollisionLayer layer, CollisionMask mask) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Փ˃C[̎擾
+         * @return	Փ˃C[
+         */
+        [[nodiscard]] CollisionLayer collisionLayer() const noexcept { return collisionLayer_; }
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ՓˑΏۃC[̃}XN̎擾
+         * @return	Փ˃C[}XN
+         */
+        [[nodiscard]] CollisionMask collisionMask() const noexcept { return collisionMask_; }
 
-    public:
         //---------------------------------------------------------------------------------
         /**
-         * @brief	qbg̏
+         * @brief	Օɂ邩̐ݒ
+         * Օ CPU ̐[xobt@֕`悳AɉBꂽIuWFNg̕`Ȃ
+         * @param	occluder	Օɂꍇ true
          */
-        virtual void onHit() noexcept {};
+        void setOccluder(bool occluder) noexcept { occluder_ = occluder; }
 
         //---------------------------------------------------------------------------------
         /**
-         * @brief	qbgΏ
+         * @brief	Օ̎擾
+         * @return	ՕȂ true
          */
-        [[nodiscard]] virtual UINT64 hitTargetTypeId() noexcept { return {}; }
+        [[nodiscard]] bool isOccluder() const noexcept { return occluder_; }
 
     public:
         //---------------------------------------------------------------------------------
@@ -99,6 +144,14 @@ namespace game {
          */
         void set(DirectX::XMFLOAT3 pos, DirectX::XMFLOAT3 rot, DirectX::XMFLOAT3 scale, DirectX::XMFLOAT4 color, UINT64 shapeId) noexcept;
 
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	sړ
+         * ʒuƃ[hs킹čXV
+         * @param	offset	ړ
+         */
+        void translate(const DirectX::XMFLOAT3& offset) noexcept;
+
         //---------------------------------------------------------------------------------
         /**
          * @brief	[hs̎擾
@@ -106,6 +159,14 @@ namespace game {
          */
         [[nodiscard]] DirectX::XMMATRIX world() const noexcept;
 
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	`p̃[hs̎擾
+         * _obt@̊i[l`̍W֖߂ϊA[hs̑OɊ|s
+         * @return  `p̃[hs
+         */
+        [[nodiscard]] DirectX::XMMATRIX instanceWorld() const noexcept;
+
         //---------------------------------------------------------------------------------
         /**
          * @brief	J[̎擾
@@ -113,20 +174,56 @@ namespace game {
          */
         [[nodiscard]] DirectX::XMFLOAT4 color() const noexcept;
 
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	kCX^X`pf[^̎擾
+         * ʒuE]Eg嗦 set()  translate() ŕێĂl狁߁A`̍W̊i[͈͂̕ϊ܂߂
+         * @return  CX^Xf[^
+         */
+        [[nodiscard]] CompactInstanceData compactInstanceData() const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	`󎯕ʎq̎擾
+         * @return  `󎯕ʎq
+         */
+        [[nodiscard]] UINT64 shapeId() const noexcept { return shapeId_; };
+
         //---------------------------------------------------------------------------------
         /**
          * @brief	a̎擾
          * @return  a
          */
-        [[nodiscard]] float radius() noexcept { return radius_; };
+        [[nodiscard]] float radius() const noexcept { return worldBounds_.sphereRadius; };
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	[hԂ̋E{[XV
+         * `̋E{[݂̃[hsŕϊ
+         */
+        void updateBounds() noexcept;
 
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	[hԂ̋E{[̎擾
+         * @return  E{[
+         */
+        [[nodiscard]] const Shape::Bounds& worldBounds() const noexcept { return worldBounds_; };
 
     protected:
-        DirectX::XMMATRIX world_ = DirectX::XMMatrixIdentity();                /// [hs
-        DirectX::XMFLOAT4 color_ = DirectX::XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);  /// J[(RGBA)
-        UINT64            shapeId_{};                                          /// `󎯕ʎq
-        UINT64            handle_{};                                           /// Q[IuWFNgnh
-        UINT64            parent_{};                                           /// eIuWFNgnh
-        float             radius_{};                                           /// 蔻pa
+        DirectX::XMFLOAT3           position_{};                                            /// ʒu
+        DirectX::XMFLOAT4           rotation_ = DirectX::XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f);  /// ](PʃNH[^jI)
+        DirectX::XMFLOAT3           scale_ = DirectX::XMFLOAT3(1.0f, 1.0f, 1.0f);           /// g嗦
+        DirectX::XMMATRIX           world_ = DirectX::XMMatrixIdentity();                   /// [hs
+        DirectX::XMFLOAT4           color_ = DirectX::XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);     /// J[(RGBA)
+        UINT64                      shapeId_{};                                             /// `󎯕ʎq
+        UINT64                      handle_{};                                              /// Q[IuWFNgnh
+        UINT64                      parent_{};                                              /// eIuWFNgnh
+        Shape::Bounds               localBounds_{};                                         /// `̋E{[
+        VertexFormat::PositionRange positionRange_{};                                       /// `̍W̊i[͈
+        Shape::Bounds               worldBounds_{};                                         /// [hԂ̋E{[
+        CollisionLayer              collisionLayer_ = CollisionLayer::Default;              /// Փ˃C[
+        CollisionMask               collisionMask_{};                                       /// ՓˑΏۃC[̃}XN
+        bool                        occluder_{};                                            /// Օ
     };
 }  // namespace game
@@ -1,6 +1,76 @@
 // Q[IuWFNgǗNX
 
 #include "game_object_manager.h"
+#include "spatial_grid.h"
+#include "shape_container.h"
+#include "upload_ring.h"
+#include "draw_queue.h"
+#include "frustum_culler.h"
+#include "occlusion_culler.h"
+#include "software_renderer.h"
+#include "indirect_argument_builder.h"
+#include "command_signature.h"
+#include <algorithm>
+#include <array>
+#include <execution>
+#include <unordered_set>
+
+namespace {
+    constexpr size_t hitChunkSize_ = 64;     // 񔻒1^XN󂯎Փ˔IuWFNg
+    constexpr float  gridCellSize_ = 4.0f;   // ԕObh̃Z̈ӂ̒
+    constexpr UINT   instanceSlot_ = 1;      // CX^Xf[^̓̓Xbg
+    constexpr UINT   mainPass_ = 0;          // \[gL[̃pXԍiCpXj
+    constexpr UINT   opaquePso_ = 0;         // \[gL[ PSO ԍisj
+    constexpr UINT   transparentPso_ = 1;    // \[gL[ PSO ԍij
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`p̃[hsɃr[sƃvWFNVsZ
+     * s͐ς񂾏ɘAĕł̂ŁAIuWFNgH炸ɐ擪珇 SIMD ŕϊ
+     * @param	matrices		`p̃[hs(Zsŏ㏑)
+     * @param	viewProjection	r[sƃvWFNVsZs
+     */
+    void XM_CALLCONV multiplyViewProjection(std::vector<DirectX::XMFLOAT4X4A>& matrices, DirectX::FXMMATRIX viewProjection) noexcept {
+        for (auto& matrix : matrices) {
+            DirectX::XMStoreFloat4x4A(&matrix, DirectX::XMMatrixMultiply(DirectX::XMLoadFloat4x4A(&matrix), viewProjection));
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`揇̃CX^Xf[^
+     * ݐ̓Abv[hq[v(CgRoC)Ȃ̂ŁA擪珇ɏ݁Aǂݖ߂Ȃ
+     * @param	objects					`pPbg̔ԍwIuWFNg
+     * @param	worldViewProjections	`pPbg̔ԍw[hEr[EvWFNVs
+     * @param	packets					`揇ɕׂ`pPbg
+     * @param	count					ސ
+     * @param	instances				ݐ
+     */
+    void writeInstances(const std::vector<const game::GameObject*>& objects, const std::vector<DirectX::XMFLOAT4X4A>& worldViewProjections,
+        const std::vector<DrawPacket>& packets, UINT count, InstanceData* instances) noexcept {
+        for (UINT i = 0; i < count; ++i) {
+            const auto index = packets[i].index;
+            // _f[^Ƃēn̂œ]u͕sv
+            instances[i].worldViewProjection_ = worldViewProjections[index];
+            instances[i].color_ = objects[index]->color();
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`揇̈kCX^Xf[^
+     * @param	objects		`pPbg̔ԍwIuWFNg
+     * @param	packets		`揇ɕׂ`pPbg
+     * @param	count		ސ
+     * @param	instances	ݐ
+     */
+    void writeCompactInstances(const std::vector<const game::GameObject*>& objects, const std::vector<DrawPacket>& packets, UINT count,
+        CompactInstanceData* instances) noexcept {
+        for (UINT i = 0; i < count; ++i) {
+            instances[i] = objects[packets[i].index]->compactInstanceData();
+        }
+    }
+}  // namespace
 
 namespace game {
     //---------------------------------------------------------------------------------
@@ -22,6 +92,133 @@ namespace game {
             creation_.shrink_to_fit();
             hit_.shrink_to_fit();
             delete_.shrink_to_fit();
+
+            objectList_.clear();
+            objectList_.shrink_to_fit();
+            grid_.clear();
+
+            batch_.clear();
+            batch_.shrink_to_fit();
+            queued_.clear();
+            queued_.shrink_to_fit();
+            queuedWorlds_.clear();
+            queuedWorlds_.shrink_to_fit();
+            drawQueue_.clear();
+            culler_.clear();
+            visible_.clear();
+            visible_.shrink_to_fit();
+            occlusionCuller_ = {};
+            indirectArguments_.clear();
+            softwareInstances_.clear();
+            softwareInstances_.shrink_to_fit();
+            softwareCompactInstances_.clear();
+            softwareCompactInstances_.shrink_to_fit();
+
+            hitters_.clear();
+            pairBuffers_.clear();
+            pairs_.clear();
+            exits_.clear();
+            contacts_.clear();
+        }
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ԕObh\z
+         * o^nhɑāAʂ̏Č\ɂ
+         */
+        void buildGrid() noexcept {
+            objectList_.clear();
+            objectList_.reserve(objects_.size());
+            for (auto& it : objects_) {
+                objectList_.emplace_back(it.second.get());
+            }
+            std::sort(objectList_.begin(), objectList_.end(),
+                [](const GameObject* a, const GameObject* b) { return a->handle() < b->handle(); });
+
+            grid_.setCellSize(gridCellSize_);
+            grid_.build(objectList_);
+        }
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Փ˔IuWFNg̐ڐGyAɌo
+         */
+        void collectContacts() noexcept {
+            // Փ˔IuWFNg
+            hitters_.clear();
+            for (auto handle : hit_) {
+                if (auto it = objects_.find(handle); it != objects_.end()) {
+                    hitters_.emplace_back(it->second.get());
+                }
+            }
+
+            // Փ˔IuWFNg͈͖ɕāÃ͈͖obt@֏
+            const size_t chunkCount = (hitters_.size() + hitChunkSize_ - 1) / hitChunkSize_;
+            if (pairBuffers_.size() < chunkCount) {
+                pairBuffers_.resize(chunkCount);
+            }
+            auto detectChunk = [this](std::vector<ContactPair>& buffer) {
+                const auto chunk = static_cast<size_t>(&buffer - pairBuffers_.data());
+                const size_t begin = chunk * hitChunkSize_;
+                const size_t end = (std::min)(begin + hitChunkSize_, hitters_.size());
+
+                buffer.clear();
+                for (size_t i = begin; i < end; ++i) {
+                    detectContacts(*hitters_[i], buffer);
+                }
+            };
+            if (chunkCount > 1) {
+                std::for_each(std::execution::par, pairBuffers_.begin(), pairBuffers_.begin() + chunkCount, detectChunk);
+            }
+            else if (chunkCount == 1) {
+                detectChunk(pairBuffers_.front());
+            }
+
+            // ănhɕׁAʒmČ\ɂ
+            pairs_.clear();
+            for (size_t i = 0; i < chunkCount; ++i) {
+                pairs_.insert(pairs_.end(), pairBuffers_[i].begin(), pairBuffers_[i].end());
+            }
+            std::sort(pairs_.begin(), pairs_.end());
+            // ݂ɏՓ˔肷IuWFNgm̃yA͈xʒm
+            pairs_.erase(std::unique(pairs_.begin(), pairs_.end()), pairs_.end());
+        }
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	oڐGyÅJnEpEIʒm
+         */
+        void dispatchContacts() noexcept {
+            // Ot[ڐGĂΌpAłȂΊJn
+            for (const auto& pair : pairs_) {
+                if (contacts_.erase(pair) > 0) {
+                    dispatchContact(pair, &GameObject::onHitStay);
+                }
+                else {
+                    dispatchContact(pair, &GameObject::onHitEnter);
+                }
+            }
+
+            // t[oȂyA͐ڐGI
+            if (!contacts_.empty()) {
+                exits_.assign(contacts_.begin(), contacts_.end());
+                std::sort(exits_.begin(), exits_.end());
+                for (const auto& pair : exits_) {
+                    dispatchContact(pair, &GameObject::onHitExit);
+                }
+            }
+
+            contacts_.clear();
+            contacts_.insert(pairs_.begin(), pairs_.end());
+        }
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ڐG̃yA邩
+         * @return	ڐG̃yA true
+         */
+        [[nodiscard]] bool hasContacts() const noexcept {
+            return !contacts_.empty();
         }
 
         //---------------------------------------------------------------------------------
@@ -39,6 +236,96 @@ namespace game {
         std::unordered_map<UINT64, std::unique_ptr<GameObject>>                      objects_{};   /// Q[IuWFNg
         std::vector<std::pair<std::unique_ptr<GameObject>, int>>                     delete_{};    /// 폜IuWFNgnh
         std::vector<UINT64>                                                          hit_{};       /// Փ˔IuWFNgnh
+
+        SpatialGrid                                  grid_{};                         /// Փ˔ƋԌŋLԕObh
+        std::vector<GameObject*>                     batch_{};                        /// `IuWFNg
+        std::vector<const GameObject*>               queued_{};                       /// `pPbg̔ԍwIuWFNg(ς񂾏)
+        std::vector<DirectX::XMFLOAT4X4A>            queuedWorlds_{};                 /// `pPbg̔ԍw`p̃[hs(ς񂾏)
+        DrawQueue                                    drawQueue_{};                    /// `pPbgL[
+        FrustumCuller                                culler_{};                       /// JO
+        std::vector<UINT>                            visible_{};                      /// ƏdȂ`IuWFNg̔ԍ
+        OcclusionCuller                              occlusionCuller_{};              /// ՕJO
+        IndirectArgumentBuilder                      indirectArguments_{};            /// Ԑڕ`̈
+        std::vector<InstanceData>                    softwareInstances_{};            /// \tgEFA`̃CX^Xf[^
+        std::vector<CompactInstanceData>             softwareCompactInstances_{};     /// \tgEFA`̈kCX^Xf[^
+        std::array<CollisionMask, collisionLayerMax> layerTable_ = makeLayerTable();  /// C[Ԃ̏Փˉۃe[u
+
+    private:
+        /// ڐGyAinhj
+        using ContactPair = std::pair<UINT64, UINT64>;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ڐGyÃnbV֐
+         */
+        struct ContactPairHash {
+            [[nodiscard]] size_t operator()(const ContactPair& pair) const noexcept {
+                return std::hash<UINT64>{}(pair.first * 0x9E3779B97F4A7C15ull ^ pair.second);
+            }
+        };
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Փ˔IuWFNg̐ڐGyAo
+         * @param	hitter	Փ˔IuWFNg
+         * @param	out		oڐGyȀo͐
+         */
+        void detectContacts(GameObject& hitter, std::vector<ContactPair>& out) const noexcept {
+            const auto myPos = DirectX::XMLoadFloat3(&hitter.worldBounds().sphereCenter);
+            const auto myHandle = hitter.handle();
+
+            // ՓˑΏۂ̃C[̂݁AEdȂZɂIuWFNg𔻒肷
+            const auto layers = hitter.collisionMask() & layerTable_[layerIndex(hitter.collisionLayer())];
+            if (layers == 0) {
+                return;
+            }
+            grid_.forEachCandidate(myPos, DirectX::XMVectorReplicate(hitter.radius()), layers, [&](const GameObject& target) {
+                if (&target == &hitter) {
+                    return;
+                }
+                auto hitRadius = hitter.radius() + target.radius();
+                auto targetPos = DirectX::XMLoadFloat3(&target.worldBounds().sphereCenter);
+                auto distance = DirectX::XMVectorGetX(DirectX::XMVector3Length(DirectX::XMVectorSubtract(myPos, targetPos)));
+                if (distance < hitRadius) {
+                    const auto targetHandle = target.handle();
+                    out.emplace_back(myHandle < targetHandle ? ContactPair{ myHandle, targetHandle } : ContactPair{ targetHandle, myHandle });
+                }
+            });
+        }
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ڐGyA̗IuWFNg֒ʒm
+         * @param	pair		ڐGyA
+         * @param	callback	ʒm֐
+         */
+        void dispatchContact(const ContactPair& pair, void (GameObject::*callback)(UINT64) noexcept) noexcept {
+            // 폜ς݂̃IuWFNgɂ͒ʒmȂ
+            if (auto it = objects_.find(pair.first); it != objects_.end()) {
+                (it->second.get()->*callback)(pair.second);
+            }
+            if (auto it = objects_.find(pair.second); it != objects_.end()) {
+                (it->second.get()->*callback)(pair.first);
+            }
+        }
+
+        std::vector<GameObject*>                         objectList_{};   /// Obhɓo^IuWFNginhj
+        std::vector<GameObject*>                         hitters_{};      /// t[̏Փ˔IuWFNg
+        std::vector<std::vector<ContactPair>>            pairBuffers_{};  /// ͈͖̐ڐGyAobt@
+        std::vector<ContactPair>                         pairs_{};        /// t[̐ڐGyAinhj
+        std::vector<ContactPair>                         exits_{};        /// ڐGIyAinhj
+        std::unordered_set<ContactPair, ContactPairHash> contacts_{};     /// Ot[܂ł̐ڐGyA
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	SC[ԂŏՓ˂e[u쐬
+         * @return	C[Ԃ̏Փˉۃe[u
+         */
+        static std::array<CollisionMask, collisionLayerMax> makeLayerTable() noexcept {
+            std::array<CollisionMask, collisionLayerMax> table{};
+            table.fill(collisionMaskAll);
+            return table;
+        }
     };
     GameObjectContainer container_{};  /// Q[IuWFNgRei
 
@@ -77,29 +364,21 @@ namespace game {
      * @brief	ǗIuWFNǧXV
      */
     void GameObjectManager::postUpdate() noexcept {
+        // ړ̃[hsŋE{[XV
+        for (auto& it : container_.objects_) {
+            it.second->updateBounds();
+        }
+
+        // Փ˔ƋԌŎgObh\z
+        container_.buildGrid();
+
         // Փ˔菈
-        if (!container_.hit_.empty()) {
-            for (auto handle : container_.hit_) {
-                auto obj = gameObject(handle);
-                if (!obj) {
-                    continue;
-                }
-                auto myPos = obj.value()->world().r[3];
-
-                for (auto& it : container_.objects_) {
-                    if (it.first == handle ||
-                        it.second->typeId() != obj.value()->hitTargetTypeId()) {
-                        continue;
-                    }
-                    auto hitRadius = obj.value()->radius() + it.second->radius();
-                    auto targetPos = it.second->world().r[3];
-                    auto distance = DirectX::XMVectorGetX(DirectX::XMVector3Length(DirectX::XMVectorSubtract(myPos, targetPos)));
-                    if (distance < hitRadius) {
-                        obj.value()->onHit();
-                        it.second->onHit();
-                    }
-                }
-            }
+        if (!container_.hit_.empty() || container_.hasContacts()) {
+
+            // ڐGyǍo͕ɍsAʒm̓nhɒs
+            container_.collectContacts();
+            container_.dispatchContacts();
+
             container_.hit_.clear();
         }
 
@@ -118,13 +397,281 @@ namespace game {
     //---------------------------------------------------------------------------------
     /**
      * @brief	ǗIuWFNg̕`
+     * \[gL[ŕ`揇߁AXe[g͈͂܂Ƃ߂ăCX^X`悷
+     * s͌`󖈂ɎOA͉`悷
+     * CX^Xf[^ UploadRing mۂ
+     * R}hVOl`nƁA`̈ UploadRing ɏ ExecuteIndirect ŕ`悷(XgN`[hobt@̏ꍇ̂)
+     * @param	commandList			R}hXg
+     * @param	rootSignature		ݒς݂̃[gVOl`(CX^Xf[^̓n߂)
+     * @param	opaquePso			sp̃pCvCXe[g
+     * @param	transparentPso		p̃pCvCXe[g([x܂Ȃ)
+     * @param	camera				[x̊ƂȂJ
+     * @param	commandSignature	Ԑڕ`̃R}hVOl`(nullptr ̏ꍇ͌`󖈂ɕ`R}h𔭍s)
+     */
+    void GameObjectManager::draw(const CommandList& commandList, const RootSignature& rootSignature, const PiplineStateObject& opaquePso,
+        const PiplineStateObject& transparentPso, const Camera& camera, const CommandSignature* commandSignature) noexcept {
+        const bool compact = rootSignature.instanceFormat() == RootSignature::InstanceFormat::Compact;
+        const auto count = buildDrawQueue(camera, !compact);
+        if (count == 0) {
+            return;
+        }
+        const auto& queued = container_.queued_;
+        const auto& packets = container_.drawQueue_.packets();
+
+        // SIuWFNg̃CX^Xf[^`揇1̘Ä֏
+        const UINT stride = compact ? sizeof(CompactInstanceData) : sizeof(InstanceData);
+        const auto allocation = UploadRing::instance().allocate(UINT64(stride) * count);
+        if (!allocation) {
+            assert(false && "CX^Xf[^̊mۂɎs܂");
+            return;
+        }
+        if (compact) {
+            // k`͎p̂܂ܓnAr[EvWFNVϊ͒_VF[_ōs
+            writeCompactInstances(queued, packets, count, reinterpret_cast<CompactInstanceData*>(allocation->cpu));
+        }
+        else {
+            // ς񂾏̍s܂Ƃ߂ĕϊĂA`揇ɏ
+            multiplyViewProjection(container_.queuedWorlds_, DirectX::XMMatrixMultiply(camera.viewMatrix(), camera.projection()));
+            writeInstances(queued, container_.queuedWorlds_, packets, count, reinterpret_cast<InstanceData*>(allocation->cpu));
+        }
+        const bool structuredBuffer = rootSignature.instanceBinding() == RootSignature::InstanceBinding::StructuredBuffer;
+        if (structuredBuffer) {
+            // XgN`[hobt@ƂăAhX𒼐ڐݒ肷
+            commandList.setGraphicsRootShaderResourceView(RootSignature::instanceBufferParameterIndex, allocation->gpu);
+        }
+        else {
+            D3D12_VERTEX_BUFFER_VIEW view{};
+            view.BufferLocation = allocation->gpu;
+            view.SizeInBytes = static_cast<UINT>(allocation->size);
+            view.StrideInBytes = stride;
+            commandList.setVertexBuffer(instanceSlot_, view);
+        }
+
+        // R}hVOl`΁A`̈܂Ƃ߂ď ExecuteIndirect ŕ`悷
+        if (structuredBuffer && commandSignature) {
+            drawIndirect(commandList, opaquePso, transparentPso, *commandSignature);
+            return;
+        }
+
+        // Xe[g(pXAPSOA`)ApPbg1̕`R}h𔭍s
+        for (UINT begin = 0; begin < count;) {
+            const auto state = DrawQueue::stateKey(packets[begin].key);
+            UINT end = begin + 1;
+            while (end < count && DrawQueue::stateKey(packets[end].key) == state) {
+                ++end;
+            }
+            // PSO ͐؂ւݒ肳(s甼ֈڂ鎞)
+            commandList.setPipelineState(DrawQueue::pso(state) == transparentPso_ ? transparentPso.get() : opaquePso.get());
+
+            const auto shapeId = queued[packets[begin].index]->shapeId();
+            if (structuredBuffer) {
+                // 擪CX^Xԍ̓[g萔œn
+                commandList.setGraphicsRoot32BitConstant(RootSignature::instanceBaseParameterIndex, begin);
+                ShapeContainer::instance().draw(commandList, shapeId, end - begin, 0);
+            }
+            else {
+                ShapeContainer::instance().draw(commandList, shapeId, end - begin, begin);
+            }
+            begin = end;
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`pPbg ExecuteIndirect ŕ`悷
+     * Xe[gApPbgɕ`̈1gݗāAt[̑S1̘Ä֏
+     * PSOE_obt@Ev~eBug|W[ς鏊Ńob`𕪂Aob`1 ExecuteIndirect 𔭍s
+     * CX^Xf[^ draw() Őݒς݂ł邱
+     * @param	commandList			R}hXg
+     * @param	opaquePso			sp̃pCvCXe[g
+     * @param	transparentPso		p̃pCvCXe[g
+     * @param	commandSignature	Ԑڕ`̃R}hVOl`
+     */
+    void GameObjectManager::drawIndirect(const CommandList& commandList, const PiplineStateObject& opaquePso, const PiplineStateObject& transparentPso,
+        const CommandSignature& commandSignature) noexcept {
+        const auto& queued = container_.queued_;
+        const auto& packets = container_.drawQueue_.packets();
+        const auto  count = static_cast<UINT>(packets.size());
+
+        auto& builder = container_.indirectArguments_;
+        builder.clear();
+        UINT                                       currentPso = 0;
+        std::optional<ShapeContainer::DrawBinding> current{};
+        for (UINT begin = 0; begin < count;) {
+            const auto state = DrawQueue::stateKey(packets[begin].key);
+            UINT end = begin + 1;
+            while (end < count && DrawQueue::stateKey(packets[end].key) == state) {
+                ++end;
+            }
+
+            // ]ςłȂ`͕`悵Ȃ
+            const auto binding = ShapeContainer::instance().drawBinding(queued[packets[begin].index]->shapeId());
+            if (binding) {
+                const UINT pso = DrawQueue::pso(state);
+                if (!current || pso != currentPso || binding->topology != current->topology ||
+                    binding->vertexBuffer.BufferLocation != current->vertexBuffer.BufferLocation) {
+                    // ob`̐擪̃pPbgXe[g߂
+                    builder.beginBatch(begin);
+                    currentPso = pso;
+                    current = binding;
+                }
+                builder.add(binding->range, end - begin, begin);
+            }
+            begin = end;
+        }
+        if (builder.arguments().empty()) {
+            return;
+        }
+
+        const auto allocation = UploadRing::instance().allocate(builder.size());
+        if (!allocation) {
+            assert(false && "Ԑڕ`̈̊mۂɎs܂");
+            return;
+        }
+        builder.write(allocation->cpu);
+
+        for (const auto& indirectBatch : builder.batches()) {
+            const auto  key = packets[indirectBatch.source].key;
+            const auto& binding = ShapeContainer::instance().drawBinding(queued[packets[indirectBatch.source].index]->shapeId());
+            commandList.setPipelineState(DrawQueue::pso(key) == transparentPso_ ? transparentPso.get() : opaquePso.get());
+            ShapeContainer::instance().bind(commandList, binding.value());
+            commandList.executeIndirect(commandSignature, indirectBatch.count, allocation->resource,
+                allocation->offset + UINT64(indirectBatch.first) * sizeof(IndirectArgumentBuilder::Arguments));
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ǗIuWFNg\tgEFA`悷
+     * draw() ƓJOƕ`揇ŁA`̃CX^Xf[^`悷
+     * @param	renderer		`
+     * @param	rootSignature	draw() Ŏg[gVOl`(CX^Xf[^̌`߂)
+     * @param	camera			Ɛ[x̊ƂȂJ
+     */
+    void GameObjectManager::drawSoftware(SoftwareRenderer& renderer, const RootSignature& rootSignature, const Camera& camera) noexcept {
+        const bool compact = rootSignature.instanceFormat() == RootSignature::InstanceFormat::Compact;
+        const auto count = buildDrawQueue(camera, !compact);
+        if (count == 0) {
+            return;
+        }
+        const auto& queued = container_.queued_;
+        const auto& packets = container_.drawQueue_.packets();
+
+        // k` draw() ƓʎqʂĂ`悷
+        // ݐ̓t[ԂŎg
+        const auto viewProjection = DirectX::XMMatrixMultiply(camera.viewMatrix(), camera.projection());
+        auto&      instances = container_.softwareInstances_;
+        auto&      compactInstances = container_.softwareCompactInstances_;
+        if (compact) {
+            compactInstances.resize(count);
+            writeCompactInstances(queued, packets, count, compactInstances.data());
+        }
+        else {
+            instances.resize(count);
+            multiplyViewProjection(container_.queuedWorlds_, viewProjection);
+            writeInstances(queued, container_.queuedWorlds_, packets, count, instances.data());
+        }
+
+        for (UINT begin = 0; begin < count;) {
+            const auto state = DrawQueue::stateKey(packets[begin].key);
+            UINT end = begin + 1;
+            while (end < count && DrawQueue::stateKey(packets[end].key) == state) {
+                ++end;
+            }
+            if (const auto geometry = ShapeContainer::instance().geometry(queued[packets[begin].index]->shapeId())) {
+                if (compact) {
+                    renderer.draw(geometry.value(), &compactInstances[begin], end - begin, viewProjection);
+                }
+                else {
+                    renderer.draw(geometry.value(), &instances[begin], end - begin);
+                }
+            }
+            begin = end;
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`悷IuWFNgIсA`pPbg`揇ɕׂ
+     * ʂ container_.queued_  container_.drawQueue_ ɎcA`pPbg̔ԍ container_.queued_ ̈ʒuw
+     * s`̃CX^Xf[^gꍇ́A`p̃[hsς񂾏 container_.queuedWorlds_ ֏W߂Ă
+     * @param	camera			Ɛ[x̊ƂȂJ
+     * @param	gatherWorlds	`p̃[hsW߂ꍇ true
+     * @return	`pPbg̐
      */
-    void GameObjectManager::draw(const CommandList& commandList) noexcept {
-        constexpr UINT objectShaderSlot_ = 1;  // IuWFNgpVF[_[Xbg
+    [[nodiscard]] UINT GameObjectManager::buildDrawQueue(const Camera& camera, bool gatherWorlds) noexcept {
+        auto& batch = container_.batch_;
+        batch.clear();
         for (auto& it : container_.objects_) {
-            it.second->updateDrawBuffer();
-            it.second->setDrawCommand(commandList, objectShaderSlot_);
+            batch.emplace_back(it.second.get());
+        }
+        if (batch.empty()) {
+            container_.drawQueue_.clear();
+            return 0;
         }
+
+        // ̊OɂIuWFNg͕`悵Ȃ
+        const auto view = camera.viewMatrix();
+        const auto viewProjection = DirectX::XMMatrixMultiply(view, camera.projection());
+        auto&      culler = container_.culler_;
+        culler.setViewProjection(viewProjection);
+        culler.clear();
+        for (const auto* object : batch) {
+            const auto& bounds = object->worldBounds();
+            culler.push(bounds.sphereCenter, bounds.sphereRadius);
+        }
+        auto& visible = container_.visible_;
+        culler.cull(visible);
+
+        // Օ CPU Ő[x`悵ǍɉBꂽIuWFNg
+        // sȎՕ`悷
+        auto& occlusion = container_.occlusionCuller_;
+        occlusion.begin(viewProjection);
+        for (const auto i : visible) {
+            const auto* object = batch[i];
+            if (!object->isOccluder() || object->color().w < 1.0f) {
+                continue;
+            }
+            if (const auto geometry = ShapeContainer::instance().geometry(object->shapeId())) {
+                occlusion.addOccluder(object->world(), geometry.value());
+            }
+        }
+        if (occlusion.rasterize()) {
+            visible.erase(std::remove_if(visible.begin(), visible.end(), [&batch, &occlusion](UINT i) {
+                const auto& bounds = batch[i]->worldBounds();
+                return !occlusion.isVisible(bounds.boxCenter, bounds.boxExtents);
+            }), visible.end());
+        }
+
+        // IuWFNgɕ`pPbgς݁A\[gL[ɕׂ
+        // `p̃[hs̓IuWFNgH邱̎ɘAz֏W߁AZ͕`掞ɂ܂Ƃ߂čs
+        auto& queue = container_.drawQueue_;
+        auto& queued = container_.queued_;
+        auto& worlds = container_.queuedWorlds_;
+        queue.clear();
+        queued.clear();
+        worlds.clear();
+        const float depthScale = 1.0f / camera.farClip();
+        for (const auto i : visible) {
+            const auto* object = batch[i];
+            const auto  shape = ShapeContainer::instance().index(object->shapeId());
+            if (!shape.has_value()) {
+                continue;
+            }
+            // [x͋E̒S̃r[Ԃ Z ő
+            const auto  center = DirectX::XMLoadFloat3(&object->worldBounds().sphereCenter);
+            const float depth = DirectX::XMVectorGetZ(DirectX::XMVector3Transform(center, view)) * depthScale;
+            const bool  transparent = object->color().w < 1.0f;
+            queue.push(DrawQueue::makeKey(mainPass_, transparent, transparent ? transparentPso_ : opaquePso_, shape.value(), depth),
+                static_cast<UINT>(queued.size()));
+            queued.emplace_back(object);
+            if (gatherWorlds) {
+                DirectX::XMStoreFloat4x4A(&worlds.emplace_back(), object->instanceWorld());
+            }
+        }
+        queue.sort();
+
+        return static_cast<UINT>(queue.packets().size());
     }
 
     //---------------------------------------------------------------------------------
@@ -181,6 +728,86 @@ namespace game {
         container_.hit_.emplace_back(handle);
     }
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	C[Ԃ̏Փˉۂݒ
+     * @param	a		Փ˃C[
+     * @param	b		Փ˃C[
+     * @param	enable	Փ˂ꍇ true
+     */
+    void GameObjectManager::setLayerCollision(CollisionLayer a, CollisionLayer b, bool enable) noexcept {
+        auto& tableA = container_.layerTable_[layerIndex(a)];
+        auto& tableB = container_.layerTable_[layerIndex(b)];
+        if (enable) {
+            tableA |= layerBit(b);
+            tableB |= layerBit(a);
+        }
+        else {
+            tableA &= ~layerBit(b);
+            tableB &= ~layerBit(a);
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CƌIuWFNg߂Ɏ擾
+     * @param	origin		C̎n_
+     * @param	direction	C̕
+     * @param	maxDistance	C̒
+     * @param	filter		i荞ݏ
+     * @param	hits		ʂ̏ݐ
+     * @param	capacity	ݐ̗vf
+     * @return	񂾌ʂ̐
+     */
+    size_t GameObjectManager::raycast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction, float maxDistance,
+        const QueryFilter& filter, QueryHit* hits, size_t capacity) const noexcept {
+        return container_.grid_.raycast(origin, direction, maxDistance, filter, hits, capacity);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ƏdȂIuWFNg擾
+     * @param	center		̒S
+     * @param	radius		̔a
+     * @param	filter		i荞ݏ
+     * @param	handles		ʂ̏ݐ
+     * @param	capacity	ݐ̗vf
+     * @return	񂾌ʂ̐
+     */
+    size_t GameObjectManager::overlapSphere(const DirectX::XMFLOAT3& center, float radius,
+        const QueryFilter& filter, UINT64* handles, size_t capacity) const noexcept {
+        return container_.grid_.overlapSphere(center, radius, filter, handles, capacity);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	AABB ƏdȂIuWFNg擾
+     * @param	center		AABB ̒S
+     * @param	extents		AABB ̊e̔̒
+     * @param	filter		i荞ݏ
+     * @param	handles		ʂ̏ݐ
+     * @param	capacity	ݐ̗vf
+     * @return	񂾌ʂ̐
+     */
+    size_t GameObjectManager::overlapBox(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents,
+        const QueryFilter& filter, UINT64* handles, size_t capacity) const noexcept {
+        return container_.grid_.overlapBox(center, extents, filter, handles, capacity);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	߂ k ̃IuWFNg擾
+     * @param	position	̒S
+     * @param	filter		i荞ݏ
+     * @param	hits		ʂ̏ݐ
+     * @param	k			擾鐔(ݐ̗vf)
+     * @return	񂾌ʂ̐
+     */
+    size_t GameObjectManager::nearest(const DirectX::XMFLOAT3& position,
+        const QueryFilter& filter, QueryHit* hits, size_t k) const noexcept {
+        return container_.grid_.nearest(position, filter, hits, k);
+    }
+
     //---------------------------------------------------------------------------------
     /**
      * @brief    fXgN^
@@ -3,9 +3,16 @@
 #pragma once
 
 #include "game_object.h"
+#include "spatial_grid.h"
+#include "root_signature.h"
+#include "pipline_state_object.h"
+#include "camera.h"
 #include <functional>
 #include <typeinfo>
 
+class SoftwareRenderer;  /// O錾
+class CommandSignature;  /// O錾
+
 
 namespace game {
 
@@ -41,9 +48,31 @@ namespace game {
         //---------------------------------------------------------------------------------
         /**
          * @brief	ǗIuWFNg̕`
-         * @param	commandList	R}hXg
+         * ̊OɂIuWFNgƎՕɉBꂽIuWFNgA\[gL[ŕ`揇߁AXe[g͈͂܂Ƃ߂ăCX^X`悷
+         * s͌`󖈂ɎOA͉`悷
+         * ͐[x܂Ȃ PSO ŕ`悵AdȂmBȂ
+         * CX^Xf[^ UploadRing mۂ
+         * R}hVOl`nƁA`̈ UploadRing ɏ ExecuteIndirect ŕ`悷(XgN`[hobt@̏ꍇ̂)
+         * @param	commandList			R}hXg
+         * @param	rootSignature		ݒς݂̃[gVOl`(CX^Xf[^̓n߂)
+         * @param	opaquePso			sp̃pCvCXe[g
+         * @param	transparentPso		p̃pCvCXe[g([x܂Ȃ)
+         * @param	camera				Ɛ[x̊ƂȂJ
+         * @param	commandSignature	Ԑڕ`̃R}hVOl`(nullptr ̏ꍇ͌`󖈂ɕ`R}h𔭍s)
+         */
+        void draw(const CommandList& commandList, const RootSignature& rootSignature, const PiplineStateObject& opaquePso,
+            const PiplineStateObject& transparentPso, const Camera& camera, const CommandSignature* commandSignature = nullptr) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ǗIuWFNg\tgEFA`悷
+         * draw() ƓJOƕ`揇ŁA`̃CX^Xf[^`悷
+         * ` renderer.resolve() ōs
+         * @param	renderer		`
+         * @param	rootSignature	draw() Ŏg[gVOl`(CX^Xf[^̌`߂)
+         * @param	camera			Ɛ[x̊ƂȂJ
          */
-        void draw(const CommandList& commandList) noexcept;
+        void drawSoftware(SoftwareRenderer& renderer, const RootSignature& rootSignature, const Camera& camera) noexcept;
 
         //---------------------------------------------------------------------------------
         /**
@@ -66,6 +95,90 @@ namespace game {
          */
         void registerHit(UINT64 handle) noexcept;
 
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	C[Ԃ̏Փˉۂݒ
+         * @param	a		Փ˃C[
+         * @param	b		Փ˃C[
+         * @param	enable	Փ˂ꍇ true
+         */
+        void setLayerCollision(CollisionLayer a, CollisionLayer b, bool enable) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	CƌIuWFNg߂Ɏ擾
+         * ͑O postUpdate _̈ʒuōs
+         * @param	origin		C̎n_
+         * @param	direction	C̕
+         * @param	maxDistance	C̒
+         * @param	filter		i荞ݏ
+         * @param	hits		ʂ̏ݐ
+         * @param	capacity	ݐ̗vf
+         * @return	񂾌ʂ̐
+         */
+        [[nodiscard]] size_t raycast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction, float maxDistance,
+            const QueryFilter& filter, QueryHit* hits, size_t capacity) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ƏdȂIuWFNg擾
+         * ͑O postUpdate _̈ʒuōs
+         * @param	center		̒S
+         * @param	radius		̔a
+         * @param	filter		i荞ݏ
+         * @param	handles		ʂ̏ݐ
+         * @param	capacity	ݐ̗vf
+         * @return	񂾌ʂ̐
+         */
+        [[nodiscard]] size_t overlapSphere(const DirectX::XMFLOAT3& center, float radius,
+            const QueryFilter& filter, UINT64* handles, size_t capacity) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	AABB ƏdȂIuWFNg擾
+         * ͑O postUpdate _̈ʒuōs
+         * @param	center		AABB ̒S
+         * @param	extents		AABB ̊e̔̒
+         * @param	filter		i荞ݏ
+         * @param	handles		ʂ̏ݐ
+         * @param	capacity	ݐ̗vf
+         * @return	񂾌ʂ̐
+         */
+        [[nodiscard]] size_t overlapBox(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents,
+            const QueryFilter& filter, UINT64* handles, size_t capacity) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	߂ k ̃IuWFNg擾
+         * ͑O postUpdate _̈ʒuōs
+         * @param	position	̒S
+         * @param	filter		i荞ݏ
+         * @param	hits		ʂ̏ݐ
+         * @param	k			擾鐔(ݐ̗vf)
+         * @return	񂾌ʂ̐
+         */
+        [[nodiscard]] size_t nearest(const DirectX::XMFLOAT3& position,
+            const QueryFilter& filter, QueryHit* hits, size_t k) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	w肵^̃IuWFNg߂ k 擾
+         * @tparam	T			IuWFNǧ^
+         * @param	position	̒S
+         * @param	hits		ʂ̏ݐ
+         * @param	k			擾鐔(ݐ̗vf)
+         * @param	ignore		OIuWFNgnh
+         * @return	񂾌ʂ̐
+         */
+        template <typename T>
+        [[nodiscard]] size_t nearest(const DirectX::XMFLOAT3& position, QueryHit* hits, size_t k, UINT64 ignore = 0) const noexcept {
+            static_assert(std::is_base_of<GameObject, T>::value, "GameObject ł͂Ȃ悤ƂĂ܂");
+            QueryFilter filter{};
+            filter.typeId = typeid(T).hash_code();
+            filter.ignore = ignore;
+            return nearest(position, filter, hits, k);
+        }
+
         //---------------------------------------------------------------------------------
         /**
          * @brief	IuWFNg
@@ -106,6 +219,26 @@ namespace game {
          */
         void registerCreation(std::function<std::unique_ptr<GameObject>()> creation, const UINT64 handle) noexcept;
 
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	`悷IuWFNgIсA`pPbg`揇ɕׂ
+         * @param	camera			Ɛ[x̊ƂȂJ
+         * @param	gatherWorlds	`p̃[hsW߂ꍇ true
+         * @return	`pPbg̐
+         */
+        [[nodiscard]] UINT buildDrawQueue(const Camera& camera, bool gatherWorlds) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	`pPbg ExecuteIndirect ŕ`悷
+         * @param	commandList			R}hXg
+         * @param	opaquePso			sp̃pCvCXe[g
+         * @param	transparentPso		p̃pCvCXe[g
+         * @param	commandSignature	Ԑڕ`̃R}hVOl`
+         */
+        void drawIndirect(const CommandList& commandList, const PiplineStateObject& opaquePso, const PiplineStateObject& transparentPso,
+            const CommandSignature& commandSignature) noexcept;
+
     private:
         //---------------------------------------------------------------------------------
         /**
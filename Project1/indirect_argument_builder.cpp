@@ -0,0 +1,93 @@
+// Ԑڕ`\zNX
+
+#include "indirect_argument_builder.h"
+#include <cstring>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ƃob`Sč폜
+ */
+void IndirectArgumentBuilder::clear() noexcept {
+    arguments_.clear();
+    batches_.clear();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ob`Jn
+ * ȍ~ɒǉ́AɃob`Jn܂œob`ɂ܂Ƃ߂
+ * @param	source	ob`̊Jn̔ԍ
+ */
+void IndirectArgumentBuilder::beginBatch(UINT source) noexcept {
+    // ܂܎̃ob`Jnꍇ͋̃ob`u
+    if (!batches_.empty() && batches_.back().count == 0) {
+        batches_.back().source = source;
+        return;
+    }
+    batches_.push_back({ static_cast<UINT>(arguments_.size()), 0, source });
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`̈ǉ
+ * ob`JnĂȂ΁Aԍ 0 ̃ob`JnĂǉ
+ * @param	range			Lobt@̕`͈
+ * @param	instanceCount	CX^X
+ * @param	baseInstance	擪CX^Xԍ
+ */
+void IndirectArgumentBuilder::add(const ShapeDrawRange& range, UINT instanceCount, UINT baseInstance) noexcept {
+    if (batches_.empty()) {
+        beginBatch(0);
+    }
+
+    Arguments arguments{};
+    arguments.baseInstance = baseInstance;
+    arguments.draw.IndexCountPerInstance = range.indexCount;
+    arguments.draw.InstanceCount = instanceCount;
+    arguments.draw.StartIndexLocation = range.startIndex;
+    arguments.draw.BaseVertexLocation = static_cast<INT>(range.baseVertex);
+    // CX^Xf[^̈ʒu̓[g萔œn̂ŁASV_InstanceID  0 琔
+    arguments.draw.StartInstanceLocation = 0;
+    arguments_.push_back(arguments);
+
+    ++batches_.back().count;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	
+ * @param	destination	ݐ(size() oCgȏ)
+ */
+void IndirectArgumentBuilder::write(void* destination) const noexcept {
+    if (arguments_.empty()) {
+        return;
+    }
+    std::memcpy(destination, arguments_.data(), static_cast<size_t>(size()));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	̃oCg擾
+ * @return	oCg
+ */
+[[nodiscard]] UINT64 IndirectArgumentBuilder::size() const noexcept {
+    return UINT64(sizeof(Arguments)) * arguments_.size();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	擾
+ * @return	(ǉ)
+ */
+[[nodiscard]] const std::vector<IndirectArgumentBuilder::Arguments>& IndirectArgumentBuilder::arguments() const noexcept {
+    return arguments_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ob`擾
+ * @return	ob`(Jn)
+ */
+[[nodiscard]] const std::vector<IndirectArgumentBuilder::Batch>& IndirectArgumentBuilder::batches() const noexcept {
+    return batches_;
+}
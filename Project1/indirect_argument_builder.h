@@ -0,0 +1,108 @@
+// Ԑڕ`\zNX
+
+#pragma once
+
+#include "shape.h"
+#include <d3d12.h>
+#include <vector>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Ԑڕ`\zNX
+ * `揇ɕׂCX^X͈̔͂ ExecuteIndirect ̈gݗĂ
+ * 1̈͐擪CX^Xԍ̃[g萔 DrawIndexedInstanced ̈ŁACommandSignature ̕тƈv
+ * _obt@Ev~eBu`EPSO LAob`ɂ܂Ƃ߁Aob`1 ExecuteIndirect ŕ`悷
+ * D3D12  API ͌ĂяoȂ̂ŁAfoCXĂgݗĂ̓mFł
+ */
+class IndirectArgumentBuilder final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	1̕`̈
+     */
+    struct Arguments {
+        UINT                         baseInstance{};  /// 擪CX^Xԍ([g萔)
+        D3D12_DRAW_INDEXED_ARGUMENTS draw{};          /// DrawIndexedInstanced ̈
+    };
+    static_assert(sizeof(Arguments) == 24, "Ԑڕ`̈̃TCY CommandSignature ƈv܂");
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	1 ExecuteIndirect ŕ`悷͈̔
+     */
+    struct Batch {
+        UINT first{};   /// 擪̈̔ԍ
+        UINT count{};   /// ̐
+        UINT source{};  /// ob`̊JnɎw肵ԍ(Xe[g߂`Ώۂ𗘗pʂ)
+    };
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    IndirectArgumentBuilder() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~IndirectArgumentBuilder() = default;
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ƃob`Sč폜
+     */
+    void clear() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ob`Jn
+     * ȍ~ɒǉ́AɃob`Jn܂œob`ɂ܂Ƃ߂
+     * @param	source	ob`̊Jn̔ԍ
+     */
+    void beginBatch(UINT source) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`̈ǉ
+     * ob`JnĂȂ΁Aԍ 0 ̃ob`JnĂǉ
+     * @param	range			Lobt@̕`͈
+     * @param	instanceCount	CX^X
+     * @param	baseInstance	擪CX^Xԍ
+     */
+    void add(const ShapeDrawRange& range, UINT instanceCount, UINT baseInstance) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	
+     * @param	destination	ݐ(size() oCgȏ)
+     */
+    void write(void* destination) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	̃oCg擾
+     * @return	oCg
+     */
+    [[nodiscard]] UINT64 size() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	擾
+     * @return	(ǉ)
+     */
+    [[nodiscard]] const std::vector<Arguments>& arguments() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ob`擾
+     * @return	ob`(Jn)
+     */
+    [[nodiscard]] const std::vector<Batch>& batches() const noexcept;
+
+private:
+    std::vector<Arguments> arguments_{};  /// `̈
+    std::vector<Batch>     batches_{};    /// ob`
+};
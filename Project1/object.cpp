@@ -8,11 +8,11 @@ namespace game {
     /**
      * @brief	`R}hݒ
      */
-    void Object::setDrawCommand(const CommandList& commandList, UINT slot) noexcept {
-        // RX^gobt@̐ݒ
-        commandList.get()->SetGraphicsRootDescriptorTable(
+    void Object::setDrawCommand(const CommandList& commandList, UINT slot, UINT frameIndex) noexcept {
+        // t[̃RX^gobt@̐ݒ
+        commandList.setGraphicsRootDescriptorTable(
             slot,
-            constantBuffer_.getGpuDescriptorHandle());
+            constantBuffer_.getGpuDescriptorHandle(frameIndex));
     }
 
 }  // namespace game
\ No newline at end of file
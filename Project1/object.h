@@ -42,8 +42,9 @@ namespace game {
          * @brief	`R}hݒ
          * @param	commandList	R}hXg
          * @param	slot		Xbgԍ
+         * @param	frameIndex	t[CfbNX
          */
-        virtual void setDrawCommand(const CommandList& commandList, UINT slot) noexcept;
+        virtual void setDrawCommand(const CommandList& commandList, UINT slot, UINT frameIndex) noexcept;
 
     public:
         //---------------------------------------------------------------------------------
@@ -55,8 +56,9 @@ namespace game {
         //---------------------------------------------------------------------------------
         /**
          * @brief	`pobt@̍XV
+         * @param	frameIndex	t[CfbNX
          */
-        virtual void updateDrawBuffer() noexcept = 0;
+        virtual void updateDrawBuffer(UINT frameIndex) noexcept = 0;
 
     public:
         //---------------------------------------------------------------------------------
@@ -81,14 +83,13 @@ namespace game {
         //---------------------------------------------------------------------------------
         /**
          * @brief	RX^gobt@XV
-         * @param	data@XVf[^
+         * GPU ǂł\̂鑼t[̗̈ɂ͏܂Ȃ
+         * @param	frameIndex	t[CfbNX
+         * @param	data		XVf[^
          */
         template <class T>
-        void updateConstantBuffer(const T& data) noexcept {
-            std::byte* dst{};
-            constantBuffer_.constantBuffer()->Map(0, nullptr, reinterpret_cast<void**>(&dst));
-            memcpy_s(dst, sizeof(T), &data, sizeof(T));
-            constantBuffer_.constantBuffer()->Unmap(0, nullptr);
+        void updateConstantBuffer(UINT frameIndex, const T& data) noexcept {
+            memcpy_s(constantBuffer_.mappedData(frameIndex), sizeof(T), &data, sizeof(T));
         };
 
     protected:
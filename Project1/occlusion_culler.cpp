@@ -0,0 +1,298 @@
+// ՕJONX
+
+#include "occlusion_culler.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <execution>
+
+namespace {
+    constexpr float minClipW_ = 1.0e-4f;   // `E肷钸_̃NbvW w ̉iO͋߃Nbvʂ܂Ƃ݂Ȃj
+    constexpr float depthBias_ = 1.0e-4f;  // ŉBĂƂ݂Ȃ̂ɕKvȐ[x̍
+}  // namespace
+
+namespace game {
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Օ̓o^Jn
+     * @param	viewProjection	r[sƃvWFNVsZs
+     */
+    void XM_CALLCONV OcclusionCuller::begin(DirectX::FXMMATRIX viewProjection) noexcept {
+        DirectX::XMStoreFloat4x4(&viewProjection_, viewProjection);
+
+        triangles_.clear();
+        bins_.resize(tileCountX_ * tileCountY_);
+        for (auto& bin : bins_) {
+            bin.clear();
+        }
+        depth_.resize(width * height);
+
+        // `悷܂ł͉BȂ
+        tileMaxDepth_.assign(tileCountX_ * tileCountY_, 1.0f);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Օo^
+     * @param	world		Օ̃[hs
+     * @param	geometry	Օ̌`̃f[^
+     */
+    void XM_CALLCONV OcclusionCuller::addOccluder(DirectX::FXMMATRIX world, const ShapeGeometry& geometry) noexcept {
+        using namespace DirectX;
+
+        const XMMATRIX transform = XMMatrixMultiply(world, XMLoadFloat4x4(&viewProjection_));
+
+        // _XN[W֕ϊ
+        auto toScreen = [&transform](const XMFLOAT3& position, XMFLOAT3& screen) {
+            const XMVECTOR clip = XMVector3Transform(XMLoadFloat3(&position), transform);
+            const float    w = XMVectorGetW(clip);
+            if (w < minClipW_) {
+                return false;
+            }
+            const float invW = 1.0f / w;
+            screen.x = (XMVectorGetX(clip) * invW * 0.5f + 0.5f) * width;
+            screen.y = (0.5f - XMVectorGetY(clip) * invW * 0.5f) * height;
+            screen.z = XMVectorGetZ(clip) * invW;
+            return true;
+        };
+
+        // gCAOXgbv1_炵ĎOp`ɂ(͕`掞ɑ)
+        const bool     strip = geometry.topology == PrimitiveTopology::TriangleStrip;
+        const uint32_t step = strip ? 1 : 3;
+        for (uint32_t i = 0; i + 2 < geometry.indexCount; i += step) {
+            Triangle triangle{};
+            bool     valid = true;
+            for (uint32_t j = 0; j < 3 && valid; ++j) {
+                valid = toScreen(geometry.vertices[geometry.indices[i + j]].position, triangle.vertices[j]);
+            }
+            if (valid) {
+                addTriangle(triangle);
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	o^Օ[xobt@֕`悷
+     * @return	Օ1ȏ`悵 true
+     */
+    bool OcclusionCuller::rasterize() noexcept {
+        if (triangles_.empty()) {
+            return false;
+        }
+
+        // ^Cm͏ݐ悪dȂȂ̂ŕɕ`悷
+        std::for_each(std::execution::par, bins_.begin(), bins_.end(), [this](const std::vector<uint32_t>& bin) {
+            rasterizeTile(static_cast<uint32_t>(&bin - bins_.data()));
+        });
+
+        return true;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	AABB ՕɉBĂȂ肷
+     * AABB ̍łO̐[xA͈͂̑SsNZ̐[x艜ȂBĂ
+     * @param	boxCenter	AABB ̒S([h)
+     * @param	boxExtents	AABB ̊e̔̒
+     * @return	ł\ true
+     */
+    [[nodiscard]] bool OcclusionCuller::isVisible(const DirectX::XMFLOAT3& boxCenter, const DirectX::XMFLOAT3& boxExtents) const noexcept {
+        using namespace DirectX;
+
+        const XMMATRIX viewProjection = XMLoadFloat4x4(&viewProjection_);
+        const XMVECTOR center = XMLoadFloat3(&boxCenter);
+        const XMVECTOR extents = XMLoadFloat3(&boxExtents);
+
+        // 8 _XN[W֕ϊA`ƍłO̐[x߂
+        float minX = FLT_MAX;
+        float minY = FLT_MAX;
+        float maxX = -FLT_MAX;
+        float maxY = -FLT_MAX;
+        float minZ = FLT_MAX;
+        for (uint32_t i = 0; i < 8; ++i) {
+            const XMVECTOR sign = XMVectorSet(i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f, 0.0f);
+            const XMVECTOR clip = XMVector3Transform(XMVectorMultiplyAdd(extents, sign, center), viewProjection);
+            const float    w = XMVectorGetW(clip);
+            if (w < minClipW_) {
+                // J̋߂ɂꍇ͔肵Ȃ
+                return true;
+            }
+            const float invW = 1.0f / w;
+            const float x = (XMVectorGetX(clip) * invW * 0.5f + 0.5f) * width;
+            const float y = (0.5f - XMVectorGetY(clip) * invW * 0.5f) * height;
+            minX = (std::min)(minX, x);
+            maxX = (std::max)(maxX, x);
+            minY = (std::min)(minY, y);
+            maxY = (std::max)(maxY, y);
+            minZ = (std::min)(minZ, XMVectorGetZ(clip) * invW);
+        }
+
+        // ʊO͎JOɔC
+        if (maxX < 0.0f || minX >= width || maxY < 0.0f || minY >= height) {
+            return true;
+        }
+        const int x0 = (std::max)(0, static_cast<int>(std::floor(minX)));
+        const int x1 = (std::min)(static_cast<int>(width) - 1, static_cast<int>(maxX));
+        const int y0 = (std::max)(0, static_cast<int>(std::floor(minY)));
+        const int y1 = (std::min)(static_cast<int>(height) - 1, static_cast<int>(maxY));
+
+        for (int ty = y0 / tileHeight; ty <= y1 / static_cast<int>(tileHeight); ++ty) {
+            for (int tx = x0 / tileWidth; tx <= x1 / static_cast<int>(tileWidth); ++tx) {
+                // ^C̍ł̐[x艜ȂÃ^C͈͉̔͂BĂ
+                if (minZ > tileMaxDepth_[ty * tileCountX_ + tx] + depthBias_) {
+                    continue;
+                }
+
+                // ^CƋ`dȂ͈͂sNZPʂŒׂ
+                const int px0 = (std::max)(x0, tx * static_cast<int>(tileWidth));
+                const int px1 = (std::min)(x1, (tx + 1) * static_cast<int>(tileWidth) - 1);
+                const int py0 = (std::max)(y0, ty * static_cast<int>(tileHeight));
+                const int py1 = (std::min)(y1, (ty + 1) * static_cast<int>(tileHeight) - 1);
+                for (int y = py0; y <= py1; ++y) {
+                    const float* row = depth_.data() + size_t(y) * width;
+                    for (int x = px0; x <= px1; ++x) {
+                        if (row[x] + depthBias_ >= minZ) {
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Op`^C֐U蕪
+     * @param	triangle	XN[W̎Op`
+     */
+    void OcclusionCuller::addTriangle(const Triangle& triangle) noexcept {
+        const auto& v = triangle.vertices;
+        const float minX = (std::min)({ v[0].x, v[1].x, v[2].x });
+        const float maxX = (std::max)({ v[0].x, v[1].x, v[2].x });
+        const float minY = (std::min)({ v[0].y, v[1].y, v[2].y });
+        const float maxY = (std::max)({ v[0].y, v[1].y, v[2].y });
+        if (maxX < 0.0f || minX >= width || maxY < 0.0f || minY >= height) {
+            return;
+        }
+
+        const uint32_t index = static_cast<uint32_t>(triangles_.size());
+        triangles_.push_back(triangle);
+
+        const uint32_t tx0 = static_cast<uint32_t>((std::max)(0.0f, minX)) / tileWidth;
+        const uint32_t tx1 = (std::min)(static_cast<uint32_t>(maxX), width - 1) / tileWidth;
+        const uint32_t ty0 = static_cast<uint32_t>((std::max)(0.0f, minY)) / tileHeight;
+        const uint32_t ty1 = (std::min)(static_cast<uint32_t>(maxY), height - 1) / tileHeight;
+        for (uint32_t ty = ty0; ty <= ty1; ++ty) {
+            for (uint32_t tx = tx0; tx <= tx1; ++tx) {
+                bins_[ty * tileCountX_ + tx].push_back(index);
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	^CɐU蕪Op``悷
+     * ӊ֐Ɛ[xsNZW1ŕ\A4 sNZ]
+     * @param	tile	^Cԍ
+     */
+    void OcclusionCuller::rasterizeTile(uint32_t tile) noexcept {
+        using namespace DirectX;
+
+        const uint32_t tileX = (tile % tileCountX_) * tileWidth;
+        const uint32_t tileY = (tile / tileCountX_) * tileHeight;
+
+        for (uint32_t y = tileY; y < tileY + tileHeight; ++y) {
+            std::fill_n(depth_.begin() + size_t(y) * width + tileX, tileWidth, 1.0f);
+        }
+
+        const XMVECTOR pixelOffset = XMVectorSet(0.5f, 1.5f, 2.5f, 3.5f);
+        const XMVECTOR zero = XMVectorZero();
+
+        for (const auto index : bins_[tile]) {
+            XMFLOAT3 v[3] = { triangles_[index].vertices[0], triangles_[index].vertices[1], triangles_[index].vertices[2] };
+
+            // ʐςɂȂɑ
+            float area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[1].y - v[0].y) * (v[2].x - v[0].x);
+            if (area < 0.0f) {
+                std::swap(v[1], v[2]);
+                area = -area;
+            }
+            if (area < FLT_EPSILON) {
+                continue;
+            }
+
+            // ӊ֐ e = a * x + b * y + c (_ i ̑ΕӁA)
+            // ׂ荇Op`̊ԂɌԂłȂ悤A̕ӂ̏(e = 0)Ɋ܂߂
+            float a[3];
+            float b[3];
+            float c[3];
+            bool  topLeft[3];
+            for (uint32_t i = 0; i < 3; ++i) {
+                const auto& from = v[(i + 1) % 3];
+                const auto& to = v[(i + 2) % 3];
+                a[i] = from.y - to.y;
+                b[i] = to.x - from.x;
+                c[i] = -(a[i] * from.x + b[i] * from.y);
+                topLeft[i] = a[i] > 0.0f || (a[i] == 0.0f && b[i] > 0.0f);
+            }
+
+            // [x͕ӊ֐ŏdݕt_̐[x
+            const float invArea = 1.0f / area;
+            const float za = (a[0] * v[0].z + a[1] * v[1].z + a[2] * v[2].z) * invArea;
+            const float zb = (b[0] * v[0].z + b[1] * v[1].z + b[2] * v[2].z) * invArea;
+            const float zc = (c[0] * v[0].z + c[1] * v[1].z + c[2] * v[2].z) * invArea;
+
+            // ^C̕`͈( 4 sNZPʂɑ)
+            const float    minX = (std::min)({ v[0].x, v[1].x, v[2].x });
+            const float    maxX = (std::max)({ v[0].x, v[1].x, v[2].x });
+            const float    minY = (std::min)({ v[0].y, v[1].y, v[2].y });
+            const float    maxY = (std::max)({ v[0].y, v[1].y, v[2].y });
+            const uint32_t x0 = (std::max)(tileX, static_cast<uint32_t>((std::max)(0.0f, minX))) & ~3u;
+            const uint32_t x1 = (std::min)(tileX + tileWidth, static_cast<uint32_t>((std::max)(0.0f, maxX)) + 1);
+            const uint32_t y0 = (std::max)(tileY, static_cast<uint32_t>((std::max)(0.0f, minY)));
+            const uint32_t y1 = (std::min)(tileY + tileHeight, static_cast<uint32_t>((std::max)(0.0f, maxY)) + 1);
+
+            const XMVECTOR edgeStep[] = { XMVectorReplicate(a[0] * 4.0f), XMVectorReplicate(a[1] * 4.0f), XMVectorReplicate(a[2] * 4.0f) };
+            const XMVECTOR depthStep = XMVectorReplicate(za * 4.0f);
+
+            for (uint32_t y = y0; y < y1; ++y) {
+                const float    py = static_cast<float>(y) + 0.5f;
+                const XMVECTOR px = XMVectorAdd(XMVectorReplicate(static_cast<float>(x0)), pixelOffset);
+                XMVECTOR       edge[3];
+                for (uint32_t i = 0; i < 3; ++i) {
+                    edge[i] = XMVectorMultiplyAdd(px, XMVectorReplicate(a[i]), XMVectorReplicate(b[i] * py + c[i]));
+                }
+                XMVECTOR depth = XMVectorMultiplyAdd(px, XMVectorReplicate(za), XMVectorReplicate(zb * py + zc));
+
+                float* row = depth_.data() + size_t(y) * width;
+                for (uint32_t x = x0; x < x1; x += 4) {
+                    // 3 ӂ̓ɂsNZO̐[xōXV
+                    XMVECTOR inside = XMVectorTrueInt();
+                    for (uint32_t i = 0; i < 3; ++i) {
+                        inside = XMVectorAndInt(inside, topLeft[i] ? XMVectorGreaterOrEqual(edge[i], zero) : XMVectorGreater(edge[i], zero));
+                    }
+                    auto*          pixels = reinterpret_cast<XMFLOAT4*>(row + x);
+                    const XMVECTOR current = XMLoadFloat4(pixels);
+                    XMStoreFloat4(pixels, XMVectorSelect(current, XMVectorMin(current, depth), inside));
+
+                    for (uint32_t i = 0; i < 3; ++i) {
+                        edge[i] = XMVectorAdd(edge[i], edgeStep[i]);
+                    }
+                    depth = XMVectorAdd(depth, depthStep);
+                }
+            }
+        }
+
+        // ^C̍ł̐[x𔻒̍i荞݂Ɏg
+        float maxDepth = 0.0f;
+        for (uint32_t y = tileY; y < tileY + tileHeight; ++y) {
+            const auto begin = depth_.begin() + size_t(y) * width + tileX;
+            maxDepth = (std::max)(maxDepth, *std::max_element(begin, begin + tileWidth));
+        }
+        tileMaxDepth_[tile] = maxDepth;
+    }
+}  // namespace game
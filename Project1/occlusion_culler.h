@@ -0,0 +1,107 @@
+// ՕJONX
+
+#pragma once
+
+#include "shape_types.h"
+#include <DirectXMath.h>
+#include <vector>
+
+namespace game {
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ՕJONX
+     * Օ̌` CPU Œ𑜓x̐[xobt@֕`悵AIuWFNg AABB BĂ邩𔻒肷
+     * [xobt@̓^CɕA^Cɕɕ`悷B1s 4 sNZ SIMD ŏ
+     * ̓^C̍ł̐[xŐɍi荞݁AłȂ^CsNZPʂŒׂ
+     */
+    class OcclusionCuller final {
+    public:
+        static constexpr uint32_t width = 256;      /// [xobt@̕
+        static constexpr uint32_t height = 144;     /// [xobt@̍
+        static constexpr uint32_t tileWidth = 32;   /// ^C̕(4 ̔{)
+        static constexpr uint32_t tileHeight = 16;  /// ^C̍
+
+    public:
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief    RXgN^
+         */
+        OcclusionCuller() = default;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief    fXgN^
+         */
+        ~OcclusionCuller() = default;
+
+    public:
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Օ̓o^Jn
+         * Oo^Օ폜
+         * @param	viewProjection	r[sƃvWFNVsZs
+         */
+        void XM_CALLCONV begin(DirectX::FXMMATRIX viewProjection) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Օo^
+         * Op`XN[W֕ϊAdȂ^C֐U蕪
+         * ߃Nbvʂ܂Op`͕`悵Ȃ(ՕȂɓ|)
+         * @param	world		Օ̃[hs
+         * @param	geometry	Օ̌`̃f[^
+         */
+        void XM_CALLCONV addOccluder(DirectX::FXMMATRIX world, const ShapeGeometry& geometry) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	o^Օ[xobt@֕`悷
+         * @return	Օ1ȏ`悵 true
+         */
+        bool rasterize() noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	AABB ՕɉBĂȂ肷
+         * rasterize() ̌ɌĂяo
+         * @param	boxCenter	AABB ̒S([h)
+         * @param	boxExtents	AABB ̊e̔̒
+         * @return	ł\ true
+         */
+        [[nodiscard]] bool isVisible(const DirectX::XMFLOAT3& boxCenter, const DirectX::XMFLOAT3& boxExtents) const noexcept;
+
+    private:
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	XN[W̎Op`
+         */
+        struct Triangle {
+            DirectX::XMFLOAT3 vertices[3]{};  /// _(x, y ̓sNZAz  0 ` 1 ̐[x)
+        };
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Op`^C֐U蕪
+         * @param	triangle	XN[W̎Op`
+         */
+        void addTriangle(const Triangle& triangle) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	^CɐU蕪Op``悷
+         * @param	tile	^Cԍ
+         */
+        void rasterizeTile(uint32_t tile) noexcept;
+
+    private:
+        static constexpr uint32_t tileCountX_ = width / tileWidth;    /// ̃^C
+        static constexpr uint32_t tileCountY_ = height / tileHeight;  /// c̃^C
+
+        DirectX::XMFLOAT4X4                viewProjection_{};  /// r[sƃvWFNVsZs
+        std::vector<Triangle>              triangles_{};       /// o^Op`
+        std::vector<std::vector<uint32_t>> bins_{};            /// ^C̎Op`̔ԍ
+        std::vector<float>                 depth_{};           /// [xobt@(OقǏ)
+        std::vector<float>                 tileMaxDepth_{};    /// ^C̍ł̐[x
+    };
+}  // namespace game
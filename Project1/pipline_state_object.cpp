@@ -3,26 +3,100 @@
 #include "pipline_state_object.h"
 #include <cassert>
 
+namespace {
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_tH[}bg̓CAEg̗vf𐶐
+     * VF[_̓͂͏ float Ȃ̂ŁAi[`̈Ⴂ͓̓AZuϊ
+     * @param	vertexFormat	_tH[}bg
+     * @param	elements		vf̊i[
+     * @param	slot			_obt@̃Xbg
+     * @return	vf
+     */
+    [[nodiscard]] UINT vertexInputElements(const VertexFormat& vertexFormat, D3D12_INPUT_ELEMENT_DESC (&elements)[VertexFormat::maxElementCount], UINT slot) noexcept {
+        UINT count = 0;
+        UINT offset = 0;
+
+        DXGI_FORMAT positionFormat = DXGI_FORMAT_R32G32B32_FLOAT;
+        switch (vertexFormat.position()) {
+            case VertexFormat::Position::Half4: positionFormat = DXGI_FORMAT_R16G16B16A16_FLOAT; break;
+            case VertexFormat::Position::Snorm16x4: positionFormat = DXGI_FORMAT_R16G16B16A16_SNORM; break;
+            default: break;
+        }
+        elements[count++] = { "POSITION", 0, positionFormat, slot, offset, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 };
+        offset += vertexFormat.position() == VertexFormat::Position::Float3 ? 12 : 8;
+
+        if (vertexFormat.color() != VertexFormat::Color::None) {
+            const bool unorm = vertexFormat.color() == VertexFormat::Color::Unorm8x4;
+            elements[count++] = { "COLOR", 0, unorm ? DXGI_FORMAT_R8G8B8A8_UNORM : DXGI_FORMAT_R32G32B32A32_FLOAT, slot, offset, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 };
+            offset += unorm ? 4 : 16;
+        }
+
+        if (vertexFormat.normal() == VertexFormat::Normal::Octahedral16) {
+            elements[count++] = { "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, slot, offset, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 };
+            offset += 4;
+        }
+
+        // vf̑傫 VertexFormat::encode() ̊i[ƈv
+        assert(offset == vertexFormat.stride() && "̓CAEg_tH[}bgƈv܂");
+        return count;
+    }
+}  // namespace
+
 //---------------------------------------------------------------------------------
 /**
  * @brief	pCvCXe[gIuWFNg쐬
  * @param	shader			VF[_NX̃CX^X
  * @param	rootSignature	[gVOl`NX̃CX^X
+ * @param	vertexFormat	_tH[}bg(̓CAEg𐶐BVF[_Ɠ̂w肷)
+ * @param	depthWrite		[xނ(p false ɂāA̔BȂ悤ɂ)
  * @return	 true
  */
-    [[nodiscard]] bool PiplineStateObject::create(const Shader & shader, const RootSignature & rootSignature) noexcept {
+    [[nodiscard]] bool PiplineStateObject::create(const Shader & shader, const RootSignature & rootSignature, const VertexFormat& vertexFormat, bool depthWrite) noexcept {
     // _CAEg
-    // _obt@̃tH[}bgɍ킹Đݒ肷
-    D3D12_INPUT_ELEMENT_DESC inputElementDescs[] = {
-        {"POSITION", 0,    DXGI_FORMAT_R32G32B32_FLOAT, 0,  0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-        {   "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+    // Xbg 0 ͒_tH[}bg琶
+    // Xbg 1 ̓CX^X̃f[^i[hEr[EvWFNVs̊esƃJ[A܂͈kpƃJ[j
+    // CX^Xf[^XgN`[hobt@œnꍇ͒_f[^݂̂g
+    const D3D12_INPUT_ELEMENT_DESC matrixInstanceElementDescs[] = {
+        {"TRANSFORM", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1,  0, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1},
+        {"TRANSFORM", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1},
+        {"TRANSFORM", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1},
+        {"TRANSFORM", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1},
+        {"COLOR", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 64, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1},
+    };
+    const D3D12_INPUT_ELEMENT_DESC compactInstanceElementDescs[] = {
+        {"TRANSLATION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    1,  0, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1},
+        {"COLOR",       1, DXGI_FORMAT_R8G8B8A8_UNORM,     1, 12, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1},
+        {"ROTATION",    0, DXGI_FORMAT_R16G16B16A16_SNORM, 1, 16, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1},
+        {"SCALE",       0, DXGI_FORMAT_R16G16B16A16_FLOAT, 1, 24, D3D12_INPUT_CLASSIFICATION_PER_INSTANCE_DATA, 1},
     };
+    D3D12_INPUT_ELEMENT_DESC vertexElementDescs[VertexFormat::maxElementCount]{};
+    const UINT               vertexElementNum = vertexInputElements(vertexFormat, vertexElementDescs, 0);
+
+    D3D12_INPUT_ELEMENT_DESC inputElementDescs[VertexFormat::maxElementCount + _countof(matrixInstanceElementDescs)]{};
+    UINT                     inputElementNum = 0;
+    for (UINT i = 0; i < vertexElementNum; ++i) {
+        inputElementDescs[inputElementNum++] = vertexElementDescs[i];
+    }
+    if (rootSignature.instanceBinding() == RootSignature::InstanceBinding::VertexBuffer) {
+        if (rootSignature.instanceFormat() == RootSignature::InstanceFormat::Compact) {
+            for (const auto& desc : compactInstanceElementDescs) {
+                inputElementDescs[inputElementNum++] = desc;
+            }
+        }
+        else {
+            for (const auto& desc : matrixInstanceElementDescs) {
+                inputElementDescs[inputElementNum++] = desc;
+            }
+        }
+    }
 
     // fvXXe[g̐ݒ
+    // [x܂Ȃꍇ[xeXg͍sAšɂ͕`悵Ȃ
     D3D12_DEPTH_STENCIL_DESC depthStateDesc{};
     depthStateDesc.DepthEnable = true;
     depthStateDesc.StencilEnable = false;
-    depthStateDesc.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
+    depthStateDesc.DepthWriteMask = depthWrite ? D3D12_DEPTH_WRITE_MASK_ALL : D3D12_DEPTH_WRITE_MASK_ZERO;
     depthStateDesc.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
 
     // uhXe[g
@@ -63,7 +137,7 @@
     // pCvCXe[g
     // eݒ\̂ɂ܂Ƃ߂
     D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc{};
-    psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
+    psoDesc.InputLayout = { inputElementDescs, inputElementNum };
     psoDesc.pRootSignature = rootSignature.get();
     psoDesc.VS = { shader.vertexShader()->GetBufferPointer(), shader.vertexShader()->GetBufferSize() };
     psoDesc.PS = { shader.pixelShader()->GetBufferPointer(), shader.pixelShader()->GetBufferSize() };
@@ -29,9 +29,11 @@ public:
      * @brief	pCvCXe[gIuWFNg쐬
      * @param	shader			VF[_NX̃CX^X
      * @param	rootSignature	[gVOl`NX̃CX^X
+     * @param	vertexFormat	_tH[}bg(̓CAEg𐶐BVF[_Ɠ̂w肷)
+     * @param	depthWrite		[xނ(p false ɂāA̔BȂ悤ɂ)
      * @return	 true
      */
-    [[nodiscard]] bool create(const Shader& shader, const RootSignature& rootSignature) noexcept;
+    [[nodiscard]] bool create(const Shader& shader, const RootSignature& rootSignature, const VertexFormat& vertexFormat = VertexFormat(), bool depthWrite = true) noexcept;
 
     //---------------------------------------------------------------------------------
     /**
@@ -21,6 +21,7 @@ namespace game {
         auto quadId = ShapeContainer::instance().create<QuadPolygon>();
         set({ -.2f, 0.0f, 0.1f }, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }, { 0.0f, 1.0f, 1.0f, 1.0f }
         , quadId);
+        setCollision(CollisionLayer::Player, {});
     }
 
     //---------------------------------------------------------------------------------
@@ -47,8 +48,7 @@ namespace game {
         }
 
         // sړ
-        DirectX::XMVECTOR temp = DirectX::XMVectorSet(pos.x, pos.y, pos.z, 0.0f);
-        world_.r[3] = DirectX::XMVectorAdd(world_.r[3], temp);
+        translate(pos);
 
         if (
             Input::instance().getTrigger('B') ||
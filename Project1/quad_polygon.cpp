@@ -4,168 +4,33 @@
 #include <cassert>
 
 namespace {
-
-    //---------------------------------------------------------------------------------
-    /**
-     * @brief    _obt@tH[}bg
-     */
-    struct Vertex {
-        DirectX::XMFLOAT3 position;  // _Wix, y, zj
-        DirectX::XMFLOAT4 color;     // _Fir, g, b, aj
-    };
-}  // namespace
-
-
-//---------------------------------------------------------------------------------
-/**
- * @brief	_obt@̐
- * @return	 true
- */
-[[nodiscard]] bool QuadPolygon::createVertexBuffer() noexcept {
     // _f[^
-    Vertex vertices[] = {
-        { {-0.5f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f, 1.0f}}, // 㒸_
-        {  {0.5f, 0.5f, 0.0f}, {1.0f, 1.0f, 1.0f, 1.0f}}, // E㒸_
-        {{-0.5f, -0.5f, 0.0f}, {1.0f, 1.0f, 1.0f, 1.0f}}, // _
-        { {0.5f, -0.5f, 0.0f}, {1.0f, 1.0f, 1.0f, 1.0f}}, // E_
+    const VertexFormat::SourceVertex vertices_[] = {
+        { {-0.5f, 0.5f, 0.0f}}, // 㒸_
+        {  {0.5f, 0.5f, 0.0f}}, // E㒸_
+        {{-0.5f, -0.5f, 0.0f}}, // _
+        { {0.5f, -0.5f, 0.0f}}, // E_
     };
 
-    // _f[^̃TCY
-    const auto vertexBufferSize = sizeof(vertices);
-
-    // q[v̐ݒw
-    // CPU ANZX\ȃ𗘗pׂ̐ݒ
-    D3D12_HEAP_PROPERTIES heapProperty{};
-    heapProperty.Type = D3D12_HEAP_TYPE_UPLOAD;
-    heapProperty.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
-    heapProperty.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
-    heapProperty.CreationNodeMask = 1;
-    heapProperty.VisibleNodeMask = 1;
-
-    // ǂȃ\[X쐬邩̐ݒ
-    D3D12_RESOURCE_DESC resourceDesc{};
-    resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    resourceDesc.Alignment = 0;
-    resourceDesc.Width = vertexBufferSize;
-    resourceDesc.Height = 1;
-    resourceDesc.DepthOrArraySize = 1;
-    resourceDesc.MipLevels = 1;
-    resourceDesc.Format = DXGI_FORMAT_UNKNOWN;
-    resourceDesc.SampleDesc.Count = 1;
-    resourceDesc.SampleDesc.Quality = 0;
-    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-    resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-
-    // _obt@̐
-    auto res = Device::instance().get()->CreateCommittedResource(
-        &heapProperty,
-        D3D12_HEAP_FLAG_NONE,
-        &resourceDesc,
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr,
-        IID_PPV_ARGS(&vertexBuffer_));
-    if (FAILED(res)) {
-        assert(false && "_obt@̍쐬Ɏs");
-        return false;
-    }
-
-    // _obt@Ƀf[^]
-    // CPU ANZX\ȃAhX擾
-    Vertex* data{};
-
-    // obt@}bviCPUANZX\ɂj
-    // vertexBuffer_ 𒼐ڗp̂ł͂ȂAdata čXVC[W
-    res = vertexBuffer_->Map(0, nullptr, reinterpret_cast<void**>(&data));
-    if (FAILED(res)) {
-        assert(false && "_obt@̃}bvɎs");
-        return false;
-    }
-
-    // _f[^Rs[
-    memcpy_s(data, vertexBufferSize, vertices, vertexBufferSize);
-
-    // Rs[ÎŃ}bviCPUANZXsɂj
-    // ܂ŗ GPU p郁̈iVRAMjɃRs[ς݂Ȃ̂ŁAvertices ͕svɂȂ
-    vertexBuffer_->Unmap(0, nullptr);
-
-    // _obt@r[̐ݒ
-    vertexBufferView_.BufferLocation = vertexBuffer_->GetGPUVirtualAddress();  // _obt@̃AhX
-    vertexBufferView_.SizeInBytes = vertexBufferSize;                       // _obt@̃TCY
-    vertexBufferView_.StrideInBytes = sizeof(Vertex);                         // 1_̃TCY
-
-    // g|W[̐ݒ
-    topology_ = D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;  // lp``悷̂ TRIANGLESTRIP
-
-    return true;
-}
+    // CfbNXf[^
+    const uint16_t indices_[] = {
+        0, 1, 2, 3  // _CfbNXiTRIANGLESTRIP Ȃ̂ Z I[_[iԁjŎw肷j
+    };
+}  // namespace
 
 //---------------------------------------------------------------------------------
 /**
- * @brief	CfbNXobt@̐
- * @return	 true
+ * @brief	_f[^ƃCfbNXf[^擾
+ * @return	`̃f[^
  */
-[[nodiscard]] bool QuadPolygon::createIndexBuffer() noexcept {
-    uint16_t indices[] = {
-        0, 1, 2, 3  // _CfbNXiTRIANGLESTRIP Ȃ̂ Z I[_[iԁjŎw肷j
-    };
-
-    // CfbNXf[^̃TCY
-    const auto indexBufferSize = sizeof(indices);
-
-    // q[v̐ݒw
-    D3D12_HEAP_PROPERTIES heapProperty{};
-    heapProperty.Type = D3D12_HEAP_TYPE_UPLOAD;
-    heapProperty.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
-    heapProperty.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
-    heapProperty.CreationNodeMask = 1;
-    heapProperty.VisibleNodeMask = 1;
-
-    // \[X̐ݒs
-    D3D12_RESOURCE_DESC resourceDesc{};
-    resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-    resourceDesc.Alignment = 0;
-    resourceDesc.Width = indexBufferSize;
-    resourceDesc.Height = 1;
-    resourceDesc.DepthOrArraySize = 1;
-    resourceDesc.MipLevels = 1;
-    resourceDesc.Format = DXGI_FORMAT_UNKNOWN;
-    resourceDesc.SampleDesc.Count = 1;
-    resourceDesc.SampleDesc.Quality = 0;
-    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-    resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-
-    // CfbNXobt@̐
-    auto res = Device::instance().get()->CreateCommittedResource(
-        &heapProperty,
-        D3D12_HEAP_FLAG_NONE,
-        &resourceDesc,
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr,
-        IID_PPV_ARGS(&indexBuffer_));
-    if (FAILED(res)) {
-        assert(false && "CfbNXobt@̍쐬Ɏs");
-        return false;
-    }
-
-    // CfbNXobt@Ƀf[^]
-    uint16_t* data{};
-    res = indexBuffer_->Map(0, nullptr, reinterpret_cast<void**>(&data));
-    if (FAILED(res)) {
-        assert(false && "CfbNXobt@̃}bvɎs");
-        return false;
-    }
-
-    memcpy_s(data, indexBufferSize, indices, indexBufferSize);
-    // ܂ŗ GPU p郁̈iVRAMjɃRs[ς݂Ȃ̂ŁAindices ͕svɂȂ
-    indexBuffer_->Unmap(0, nullptr);
-
-    // CfbNXobt@r[쐬
-    indexBufferView_.BufferLocation = indexBuffer_->GetGPUVirtualAddress();
-    indexBufferView_.SizeInBytes = indexBufferSize;
-    indexBufferView_.Format = DXGI_FORMAT_R16_UINT;  // indices ̌^ 16bit ȂȂ̂ R16_UINT
-
-    // CfbNX̐ݒ
-    indexCount_ = _countof(indices);
-
-    return true;
+[[nodiscard]] ShapeGeometry QuadPolygon::geometry() const noexcept {
+    ShapeGeometry geometry{};
+    geometry.vertices = vertices_;
+    geometry.vertexCount = _countof(vertices_);
+    geometry.format = VertexFormat::compact();  // _F͔Ȃ̂ŎAW snorm16 Ŋi[
+    geometry.indices = indices_;
+    geometry.indexCount = _countof(indices_);
+    geometry.topology = PrimitiveTopology::TriangleStrip;  // lp``悷̂ TRIANGLESTRIP
+
+    return geometry;
 }
\ No newline at end of file
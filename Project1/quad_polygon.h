@@ -22,18 +22,11 @@ public:
      */
     ~QuadPolygon() = default;
 
-private:
-    //---------------------------------------------------------------------------------
-    /**
-     * @brief	_obt@̐
-     * @return	 true
-     */
-    [[nodiscard]] virtual bool createVertexBuffer() noexcept override;
-
+public:
     //---------------------------------------------------------------------------------
     /**
-     * @brief	CfbNXobt@̐
-     * @return	 true
+     * @brief	_f[^ƃCfbNXf[^擾
+     * @return	`̃f[^
      */
-    [[nodiscard]] bool createIndexBuffer() noexcept override;
+    [[nodiscard]] ShapeGeometry geometry() const noexcept override;
 };
\ No newline at end of file
@@ -0,0 +1,701 @@
+// _[OtNX
+
+#include "render_graph.h"
+#include "deferred_release.h"
+#include <algorithm>
+#include <cassert>
+
+namespace {
+    // ݂𔺂Xe[g(̃Xe[gƑgݍ킹Ȃ)
+    constexpr auto writeStates_ = D3D12_RESOURCE_STATE_RENDER_TARGET | D3D12_RESOURCE_STATE_UNORDERED_ACCESS | D3D12_RESOURCE_STATE_DEPTH_WRITE |
+                                  D3D12_RESOURCE_STATE_STREAM_OUT | D3D12_RESOURCE_STATE_COPY_DEST | D3D12_RESOURCE_STATE_RESOLVE_DEST;
+
+    constexpr UINT maxRenderTargets_ = 8;  // ɐݒł郌_[^[Qbg̐
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	lACg̔{ɐ؂グ
+     * @param	value		l
+     * @param	alignment	ACg(2 ׂ̂)
+     * @return	؂グl
+     */
+    [[nodiscard]] UINT64 alignUp(UINT64 value, UINT64 alignment) noexcept {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X̐ݒ肪肷
+     * @param	a	\[X̐ݒ
+     * @param	b	\[X̐ݒ
+     * @return	Ȃ true
+     */
+    [[nodiscard]] bool isSameDesc(const D3D12_RESOURCE_DESC& a, const D3D12_RESOURCE_DESC& b) noexcept {
+        return a.Dimension == b.Dimension && a.Alignment == b.Alignment && a.Width == b.Width && a.Height == b.Height &&
+               a.DepthOrArraySize == b.DepthOrArraySize && a.MipLevels == b.MipLevels && a.Format == b.Format &&
+               a.SampleDesc.Count == b.SampleDesc.Count && a.SampleDesc.Quality == b.SampleDesc.Quality &&
+               a.Layout == b.Layout && a.Flags == b.Flags;
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[X̓ǂݍ݂錾
+ * @param	resource	\[X̃nh
+ * @param	state		ǂݍ݂ɎgXe[g
+ * @return	g̎Q
+ */
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::read(Handle resource, D3D12_RESOURCE_STATES state) noexcept {
+    assert((state & writeStates_) == 0 && "ǂݍ݂ɏ݂̃Xe[gw肳Ă܂");
+    graph_.passes_[pass_].accesses.push_back({ resource, state, false });
+    return *this;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[X݂̏錾
+ * @param	resource	\[X̃nh
+ * @param	state		݂ɎgXe[g
+ * @return	g̎Q
+ */
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::write(Handle resource, D3D12_RESOURCE_STATES state) noexcept {
+    graph_.passes_[pass_].accesses.push_back({ resource, state, true });
+    return *this;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_[^[Qbg錾
+ * 錾 OMSetRenderTargets ̃Xbg֐ݒ肷
+ * @param	resource	\[X̃nh
+ * @param	view		_[^[Qbgr[
+ * @param	clearColor	NAF(nullptr ȂNAȂ)
+ * @return	g̎Q
+ */
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::renderTarget(Handle resource, D3D12_CPU_DESCRIPTOR_HANDLE view, const float* clearColor) noexcept {
+    auto& pass = graph_.passes_[pass_];
+    assert(pass.renderTargets.size() < maxRenderTargets_ && "_[^[Qbg܂");
+
+    Attachment attachment{};
+    attachment.resource = resource;
+    attachment.view = view;
+    if (clearColor) {
+        attachment.clear = true;
+        std::copy(clearColor, clearColor + 4, attachment.clearColor);
+    }
+    pass.renderTargets.push_back(attachment);
+
+    return write(resource, D3D12_RESOURCE_STATE_RENDER_TARGET);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	fvXobt@錾
+ * @param	resource	\[X̃nh
+ * @param	view		fvXXeVr[
+ * @param	clear		[xNA邩
+ * @param	clearDepth	NA[x
+ * @return	g̎Q
+ */
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::depthStencil(Handle resource, D3D12_CPU_DESCRIPTOR_HANDLE view, bool clear, float clearDepth) noexcept {
+    auto& pass = graph_.passes_[pass_];
+    assert(pass.depthStencil.resource == invalidHandle && "fvXobt@1ݒł܂");
+
+    pass.depthStencil.resource = resource;
+    pass.depthStencil.view = view;
+    pass.depthStencil.clear = clear;
+    pass.depthStencil.clearDepth = clearDepth;
+
+    return write(resource, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	o̓\[XɊ^ȂĂ폜ȂpXɂ
+ * @return	g̎Q
+ */
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::sideEffect() noexcept {
+    graph_.passes_[pass_].sideEffect = true;
+    return *this;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	錾pXƃ\[XSč폜
+ * ꎞeNX`p̃q[vƔzu\[X͎c
+ */
+void RenderGraph::reset() noexcept {
+    passes_.clear();
+    resources_.clear();
+    order_.clear();
+    finalBarriers_.clear();
+    stats_ = {};
+    compiled_ = false;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Oō쐬\[Xo^
+ * @param	name			\[X̖O
+ * @param	resource		\[X
+ * @param	initialState	OtsÕXe[g
+ * @param	finalState		Otsɖ߂Xe[g
+ * @param	output			Ot̏o͂ɂ邩(o͂Ɋ^ȂpX͍폜)
+ * @return	\[X̃nh
+ */
+[[nodiscard]] RenderGraph::Handle RenderGraph::importResource(const char* name, ID3D12Resource* resource, D3D12_RESOURCE_STATES initialState, D3D12_RESOURCE_STATES finalState, bool output) noexcept {
+    assert(resource && "o^郊\[X܂");
+
+    Resource entry{};
+    entry.name = name;
+    entry.imported = resource;
+    entry.initialState = initialState;
+    entry.finalState = finalState;
+    entry.output = output;
+    resources_.push_back(std::move(entry));
+
+    return static_cast<Handle>(resources_.size() - 1);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ꎞeNX`錾
+ * _[^[QbgfvXXeṼeNX`ɌBTCY̓foCXɖ₢킹
+ * @param	name		\[X̖O
+ * @param	desc		\[X̐ݒ
+ * @param	clearValue	œKꂽNAl(nullptr Ȃw肵Ȃ)
+ * @return	\[X̃nh
+ */
+[[nodiscard]] RenderGraph::Handle RenderGraph::createTexture(const char* name, const D3D12_RESOURCE_DESC& desc, const D3D12_CLEAR_VALUE* clearValue) noexcept {
+    const auto allocationInfo = Device::instance().get()->GetResourceAllocationInfo(0, 1, &desc);
+    return createTexture(name, desc, allocationInfo, clearValue);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ꎞeNX`錾
+ * @param	name			\[X̖O
+ * @param	desc			\[X̐ݒ
+ * @param	allocationInfo	q[ṽTCYƃACg
+ * @param	clearValue		œKꂽNAl(nullptr Ȃw肵Ȃ)
+ * @return	\[X̃nh
+ */
+[[nodiscard]] RenderGraph::Handle RenderGraph::createTexture(const char* name, const D3D12_RESOURCE_DESC& desc, const D3D12_RESOURCE_ALLOCATION_INFO& allocationInfo, const D3D12_CLEAR_VALUE* clearValue) noexcept {
+    // q[v̓_[^[QbgƃfvXXeVpō쐬
+    assert((desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0 && "ꎞeNX`̓_[^[QbgfvXXeVɌ܂");
+
+    Resource entry{};
+    entry.name = name;
+    entry.desc = desc;
+    entry.allocation = allocationInfo;
+    if (clearValue) {
+        entry.hasClearValue = true;
+        entry.clearValue = *clearValue;
+    }
+    resources_.push_back(std::move(entry));
+
+    return static_cast<Handle>(resources_.size() - 1);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	pXǉ
+ * @param	name	pX̖O
+ * @param	execute	pX̋L^֐
+ * @return	pX̐錾
+ */
+[[nodiscard]] RenderGraph::PassBuilder RenderGraph::addPass(const char* name, ExecuteFunction execute) noexcept {
+    Pass pass{};
+    pass.name = name;
+    pass.execute = std::move(execute);
+    passes_.push_back(std::move(pass));
+
+    return PassBuilder(*this, static_cast<UINT>(passes_.size() - 1));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	pX̍폜EoAEꎞeNX`̔zu߂
+ * foCX͎gȂ
+ * @return	(錾Ɍ肪 false)
+ */
+[[nodiscard]] bool RenderGraph::compile() noexcept {
+    compiled_ = false;
+    order_.clear();
+    finalBarriers_.clear();
+    stats_ = {};
+
+    for (auto& pass : passes_) {
+        for (const auto& access : pass.accesses) {
+            if (access.resource >= resources_.size()) {
+                assert(false && "錾ĂȂ\[XgĂ܂");
+                return false;
+            }
+        }
+        pass.culled = false;
+        pass.barriers.clear();
+        pass.discards.clear();
+    }
+
+    for (auto& resource : resources_) {
+        resource.firstPass = ~0u;
+        resource.lastPass = 0;
+        resource.heapOffset = ~0ull;
+        resource.placed = nullptr;
+    }
+
+    // o͂Ɋ^ȂpXA錾ɕׂ
+    cullPasses();
+    for (UINT i = 0; i < passes_.size(); ++i) {
+        if (!passes_[i].culled) {
+            order_.push_back(i);
+        }
+    }
+
+    // sŃ\[X̐Ԃ߂
+    for (UINT i = 0; i < order_.size(); ++i) {
+        for (const auto& access : passes_[order_[i]].accesses) {
+            auto& resource = resources_[access.resource];
+            resource.firstPass = (std::min)(resource.firstPass, i);
+            resource.lastPass = (std::max)(resource.lastPass, i);
+        }
+    }
+
+    // ꎞeNX`͍ŏɎgpXŏނ
+    // 쐬̃Xe[g͍ŏɎgXe[gɂāAOts̃Xe[g֖߂
+    for (Handle i = 0; i < resources_.size(); ++i) {
+        auto& resource = resources_[i];
+        if (resource.imported || resource.firstPass == ~0u) {
+            continue;
+        }
+        bool written = false;
+        for (const auto& access : passes_[order_[resource.firstPass]].accesses) {
+            if (access.resource == i && access.write) {
+                written = true;
+                resource.initialState = access.state;
+            }
+        }
+        if (!written) {
+            assert(false && "ꎞeNX`ޑOɓǂݍł܂");
+            return false;
+        }
+        resource.finalState = resource.initialState;
+    }
+
+    placeTransients();
+    buildBarriers();
+
+    stats_.passCount = static_cast<UINT>(order_.size());
+    stats_.culledPassCount = static_cast<UINT>(passes_.size() - order_.size());
+    stats_.barrierCount = static_cast<UINT>(finalBarriers_.size());
+    for (const auto index : order_) {
+        stats_.barrierCount += static_cast<UINT>(passes_[index].barriers.size());
+    }
+
+    compiled_ = true;
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	RpCOtR}hXgɋL^
+ * @param	commandList	R}hXg
+ * @return	(ꎞeNX`̍쐬Ɏs false)
+ */
+[[nodiscard]] bool RenderGraph::execute(const CommandList& commandList) noexcept {
+    assert(compiled_ && "RpCĂȂ_[OtsĂ܂");
+
+    if (!realizeTransients(commandList)) {
+        return false;
+    }
+
+    for (const auto index : order_) {
+        const auto& pass = passes_[index];
+
+        // pX̑ÕoA1̌Ăяoɂ܂Ƃ߂Ē
+        // R}hXgǐՂĂXe[gƓ̂͏Ȃ
+        issueBarriers(commandList, pass.barriers);
+
+        // GCAVOŐ؂ւꎞeNX`͓esȂ̂ŔjĂ
+        for (const auto handle : pass.discards) {
+            commandList.get()->DiscardResource(resource(handle), nullptr);
+        }
+
+        // _[^[QbgƃfvXobt@̐ݒƃNA
+        const bool hasDepth = pass.depthStencil.resource != invalidHandle;
+        if (!pass.renderTargets.empty() || hasDepth) {
+            D3D12_CPU_DESCRIPTOR_HANDLE views[maxRenderTargets_]{};
+            for (size_t i = 0; i < pass.renderTargets.size(); ++i) {
+                views[i] = pass.renderTargets[i].view;
+            }
+            commandList.get()->OMSetRenderTargets(static_cast<UINT>(pass.renderTargets.size()), views, false, hasDepth ? &pass.depthStencil.view : nullptr);
+
+            for (const auto& target : pass.renderTargets) {
+                if (target.clear) {
+                    commandList.clearRenderTargetView(target.view, target.clearColor);
+                }
+            }
+            if (hasDepth && pass.depthStencil.clear) {
+                commandList.clearDepthStencilView(pass.depthStencil.view, pass.depthStencil.clearDepth);
+            }
+        }
+
+        if (pass.execute) {
+            pass.execute(commandList, *this);
+        }
+    }
+
+    // o^\[Xw̃Xe[g֖߂
+    issueBarriers(commandList, finalBarriers_);
+
+    for (auto& resource : resources_) {
+        resource.placed = nullptr;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[X擾
+ * ꎞeNX` execute() ̂ݎ擾ł
+ * @param	handle	\[X̃nh
+ * @return	\[X̃|C^
+ */
+[[nodiscard]] ID3D12Resource* RenderGraph::resource(Handle handle) const noexcept {
+    if (handle >= resources_.size()) {
+        assert(false && "ȃ\[X̃nhł");
+        return nullptr;
+    }
+    const auto& resource = resources_[handle];
+    return resource.imported ? resource.imported : resource.placed;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	pX̎s擾
+ * @return	spX̔ԍ(錾)
+ */
+[[nodiscard]] const std::vector<UINT>& RenderGraph::passOrder() const noexcept {
+    return order_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	pX̑OɒoA擾
+ * @param	pass	pX̔ԍ
+ * @return	oA
+ */
+[[nodiscard]] const std::vector<RenderGraph::Barrier>& RenderGraph::passBarriers(UINT pass) const noexcept {
+    assert(pass < passes_.size() && "ȃpX̔ԍł");
+    return passes_[pass].barriers;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ꎞeNX`̃q[ṽItZbg擾
+ * @param	handle	\[X̃nh
+ * @return	ItZbg(zuĂȂ UINT64 ̍ől)
+ */
+[[nodiscard]] UINT64 RenderGraph::heapOffset(Handle handle) const noexcept {
+    assert(handle < resources_.size() && "ȃ\[X̃nhł");
+    return resources_[handle].heapOffset;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	RpCʂ̓v擾
+ * @return	v
+ */
+[[nodiscard]] const RenderGraph::Stats& RenderGraph::stats() const noexcept {
+    return stats_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	o͂Ɋ^ȂpX폜
+ * ̃pXAo̓\[X̃pXg\[XރpXc
+ */
+void RenderGraph::cullPasses() noexcept {
+    std::vector<bool> needed(resources_.size());
+    for (size_t i = 0; i < resources_.size(); ++i) {
+        needed[i] = resources_[i].output;
+    }
+
+    for (auto pass = passes_.rbegin(); pass != passes_.rend(); ++pass) {
+        bool live = pass->sideEffect;
+        for (const auto& access : pass->accesses) {
+            live = live || (access.write && needed[access.resource]);
+        }
+
+        pass->culled = !live;
+        if (!live) {
+            continue;
+        }
+
+        // cpXg\[X́AÕpX݂̏KvɂȂ
+        for (const auto& access : pass->accesses) {
+            needed[access.resource] = true;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ԂdȂȂꎞeNX`𓯂̈ɔzu
+ * 傫̂珇ɁAԂdȂzuς݂̂̂Ɨ̈悪dȂȂłႢItZbg֒u
+ */
+void RenderGraph::placeTransients() noexcept {
+    std::vector<Handle> transients{};
+    for (Handle i = 0; i < resources_.size(); ++i) {
+        if (!resources_[i].imported && resources_[i].firstPass != ~0u) {
+            transients.push_back(i);
+        }
+    }
+    std::stable_sort(transients.begin(), transients.end(), [this](Handle a, Handle b) {
+        return resources_[a].allocation.SizeInBytes > resources_[b].allocation.SizeInBytes;
+    });
+
+    const auto overlapsLifetime = [](const Resource& a, const Resource& b) {
+        return a.firstPass <= b.lastPass && b.firstPass <= a.lastPass;
+    };
+    const auto overlapsMemory = [](const Resource& a, const Resource& b) {
+        return a.heapOffset < b.heapOffset + b.allocation.SizeInBytes && b.heapOffset < a.heapOffset + a.allocation.SizeInBytes;
+    };
+
+    for (size_t i = 0; i < transients.size(); ++i) {
+        auto&      resource = resources_[transients[i]];
+        const auto alignment = std::max<UINT64>(resource.allocation.Alignment, 1);
+
+        // Փ˂̂̌ւ炵ȂAՓ˂ȂʒuT
+        resource.heapOffset = 0;
+        for (bool moved = true; moved;) {
+            moved = false;
+            for (size_t j = 0; j < i; ++j) {
+                const auto& other = resources_[transients[j]];
+                if (overlapsLifetime(resource, other) && overlapsMemory(resource, other)) {
+                    resource.heapOffset = alignUp(other.heapOffset + other.allocation.SizeInBytes, alignment);
+                    moved = true;
+                }
+            }
+        }
+
+        stats_.transientHeapSize = (std::max)(stats_.transientHeapSize, resource.heapOffset + resource.allocation.SizeInBytes);
+    }
+    stats_.transientCount = static_cast<UINT>(transients.size());
+
+    // ̈ꎞeNX`Ɨ̈L̂́AŏɎgpXŃGCAVOoA𒣂ēej
+    // Õt[ŌɎĝƋLĂꍇ̂ŁAԂɊւ炸
+    for (const auto handle : transients) {
+        const auto& resource = resources_[handle];
+        const bool  aliased = std::any_of(transients.begin(), transients.end(), [&](Handle other) {
+            return other != handle && overlapsMemory(resource, resources_[other]);
+        });
+        if (!aliased) {
+            continue;
+        }
+
+        auto& pass = passes_[order_[resource.firstPass]];
+        pass.barriers.push_back({ D3D12_RESOURCE_BARRIER_TYPE_ALIASING, handle });
+        if (resource.initialState == D3D12_RESOURCE_STATE_RENDER_TARGET || resource.initialState == D3D12_RESOURCE_STATE_DEPTH_WRITE) {
+            pass.discards.push_back(handle);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Xe[gJڂoA߂
+ * Xe[gւ̑Jڂ͏ȂAǂݍ݂ꍇ͌̃pX̓ǂݍ݃Xe[g܂Ƃ߂1őJڂ
+ */
+void RenderGraph::buildBarriers() noexcept {
+    // pXŃ\[XɕKvȃXe[g(݂Ώ݂̃Xe[gAȂΓǂݍ݂̃Xe[g̘a)
+    const auto requiredState = [](const Pass& pass, Handle handle, bool& write) {
+        auto state = D3D12_RESOURCE_STATE_COMMON;
+        write = false;
+        for (const auto& access : pass.accesses) {
+            if (access.resource != handle) {
+                continue;
+            }
+            if (access.write) {
+                assert((!write || state == access.state) && "1̃pXœ\[XقȂXe[gŏł܂");
+                state = access.state;
+                write = true;
+            }
+            else if (!write) {
+                state = state | access.state;
+            }
+        }
+        return state;
+    };
+
+    std::vector<D3D12_RESOURCE_STATES> current(resources_.size());
+    for (size_t i = 0; i < resources_.size(); ++i) {
+        current[i] = resources_[i].initialState;
+    }
+
+    for (UINT i = 0; i < order_.size(); ++i) {
+        auto& pass = passes_[order_[i]];
+
+        for (size_t a = 0; a < pass.accesses.size(); ++a) {
+            const auto handle = pass.accesses[a].resource;
+
+            // \[X͍ŏ̃ANZXł܂Ƃ߂ď
+            const auto first = std::find_if(pass.accesses.begin(), pass.accesses.end(), [handle](const Access& access) { return access.resource == handle; });
+            if (first != pass.accesses.begin() + a) {
+                continue;
+            }
+
+            bool write = false;
+            auto state = requiredState(pass, handle, write);
+
+            if (!write) {
+                // ɕKvȓǂݍ݃Xe[gSĊ܂łΑJڂȂ
+                if ((current[handle] & writeStates_) == 0 && (current[handle] & state) == state) {
+                    continue;
+                }
+                // ܂܂ł̌̃pX̓ǂݍ݃Xe[g܂Ƃ߂
+                for (UINT j = i + 1; j < order_.size(); ++j) {
+                    bool laterWrite = false;
+                    const auto laterState = requiredState(passes_[order_[j]], handle, laterWrite);
+                    if (laterWrite) {
+                        break;
+                    }
+                    state = state | laterState;
+                }
+            }
+
+            if (current[handle] == state) {
+                continue;
+            }
+            pass.barriers.push_back({ D3D12_RESOURCE_BARRIER_TYPE_TRANSITION, handle, current[handle], state });
+            current[handle] = state;
+        }
+    }
+
+    // Ots̃Xe[g֖߂
+    for (Handle i = 0; i < resources_.size(); ++i) {
+        if (current[i] != resources_[i].finalState) {
+            finalBarriers_.push_back({ D3D12_RESOURCE_BARRIER_TYPE_TRANSITION, i, current[i], resources_[i].finalState });
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ꎞeNX`p̃q[vƃ\[Xpӂ
+ * q[vȂ΍蒼AÕt[Ɠzũ\[X͍ėp
+ * 쐬\[X̓R}hXgɃXe[gǐՂ
+ * @param	commandList	R}hXg
+ * @return	
+ */
+[[nodiscard]] bool RenderGraph::realizeTransients(const CommandList& commandList) noexcept {
+    if (stats_.transientCount == 0) {
+        return true;
+    }
+
+    if (!heap_ || heapSize_ < stats_.transientHeapSize) {
+        // Âq[vƃ\[X GPU gIĂ
+        for (auto& placed : placed_) {
+            commandList.untrackResource(placed.resource.Get());
+            DeferredRelease::instance().release(placed.resource);
+        }
+        placed_.clear();
+        if (heap_) {
+            DeferredRelease::instance().release(heap_);
+            heap_.Reset();
+        }
+
+        UINT64 alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        for (const auto& resource : resources_) {
+            if (!resource.imported && resource.heapOffset != ~0ull) {
+                alignment = (std::max)(alignment, resource.allocation.Alignment);
+            }
+        }
+
+        D3D12_HEAP_DESC heapDesc{};
+        heapDesc.SizeInBytes = alignUp(stats_.transientHeapSize, alignment);
+        heapDesc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+        heapDesc.Alignment = alignment;
+        heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+
+        const auto res = Device::instance().get()->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap_));
+        if (FAILED(res)) {
+            assert(false && "ꎞeNX`pq[v̍쐬Ɏs܂");
+            heapSize_ = 0;
+            return false;
+        }
+        heapSize_ = heapDesc.SizeInBytes;
+    }
+
+    for (auto& placed : placed_) {
+        placed.used = false;
+    }
+
+    for (auto& resource : resources_) {
+        if (resource.imported || resource.heapOffset == ~0ull) {
+            continue;
+        }
+
+        auto found = std::find_if(placed_.begin(), placed_.end(), [&resource](const PlacedResource& placed) {
+            return !placed.used && placed.heapOffset == resource.heapOffset && placed.initialState == resource.initialState && isSameDesc(placed.desc, resource.desc);
+        });
+
+        if (found == placed_.end()) {
+            PlacedResource placed{};
+            placed.desc = resource.desc;
+            placed.heapOffset = resource.heapOffset;
+            placed.initialState = resource.initialState;
+
+            const auto res = Device::instance().get()->CreatePlacedResource(
+                heap_.Get(),
+                resource.heapOffset,
+                &resource.desc,
+                resource.initialState,
+                resource.hasClearValue ? &resource.clearValue : nullptr,
+                IID_PPV_ARGS(&placed.resource));
+
+            if (FAILED(res)) {
+                assert(false && "ꎞeNX`̍쐬Ɏs܂");
+                return false;
+            }
+
+            commandList.trackResource(placed.resource.Get(), placed.initialState);
+            placed_.push_back(std::move(placed));
+            found = placed_.end() - 1;
+        }
+
+        found->used = true;
+        resource.placed = found->resource.Get();
+    }
+
+    // t[ŎgȂ\[X͉
+    for (auto& placed : placed_) {
+        if (!placed.used) {
+            commandList.untrackResource(placed.resource.Get());
+            DeferredRelease::instance().release(placed.resource);
+        }
+    }
+    placed_.erase(std::remove_if(placed_.begin(), placed_.end(), [](const PlacedResource& placed) { return !placed.used; }), placed_.end());
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	oA𒣂
+ * R}hXg֑JڂvA1̌Ăяoɂ܂Ƃ߂Ĕs
+ * @param	commandList	R}hXg
+ * @param	barriers	oA
+ */
+void RenderGraph::issueBarriers(const CommandList& commandList, const std::vector<Barrier>& barriers) const noexcept {
+    for (const auto& barrier : barriers) {
+        if (barrier.type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING) {
+            commandList.aliasingBarrier(resource(barrier.resource));
+        }
+        else {
+            commandList.transition(resource(barrier.resource), barrier.after);
+        }
+    }
+    commandList.flushBarriers();
+}
@@ -0,0 +1,367 @@
+// _[OtNX
+
+#pragma once
+
+#include "device.h"
+#include "command_list.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_[OtNX
+ * pXǂݏ郊\[XƃXe[g錾Acompile() ŃoAƃzu߂Ă execute() ŋL^
+ * compile() ̓foCXgȂ CPU ̏ŁAs
+ * - o̓\[XɊ^ȂpX폜
+ * - \[X̃Xe[gJڂKvȃoA߁ApX1 ResourceBarrier ɂ܂Ƃ߂
+ * - ԂdȂȂꎞeNX`Lq[v̓̈ɔzu
+ * pX͐錾Ɏs(ǂݍރ\[XރpXɐ錾邱)
+ * t[ reset() Ă錾BꎞeNX`p̃q[vƔzu\[X̓t[܂ōėp
+ */
+class RenderGraph final {
+public:
+    using Handle = UINT;                          /// \[X̃nh
+    static constexpr Handle invalidHandle = ~0u;  /// ȃnh
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pX̋L^֐
+     * oAƃ_[^[Qbg̐ݒENA͋L^OɃ_[Ots
+     */
+    using ExecuteFunction = std::function<void(const CommandList& commandList, const RenderGraph& graph)>;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	RpCʂ̃oA
+     * \[X̓nhŎAexecute() ŃR}hXg֑Jڂv
+     */
+    struct Barrier {
+        D3D12_RESOURCE_BARRIER_TYPE type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;  /// oA̎(JڂGCAVO)
+        Handle                      resource = invalidHandle;                       /// Ώۂ̃\[X
+        D3D12_RESOURCE_STATES       before = D3D12_RESOURCE_STATE_COMMON;           /// JڑÕXe[g
+        D3D12_RESOURCE_STATES       after = D3D12_RESOURCE_STATE_COMMON;            /// Jڌ̃Xe[g
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	RpCʂ̓v
+     */
+    struct Stats {
+        UINT   passCount{};          /// spX̐
+        UINT   culledPassCount{};    /// 폜pX̐
+        UINT   barrierCount{};       /// oA̐
+        UINT   transientCount{};     /// zuꎞeNX`̐
+        UINT64 transientHeapSize{};  /// ꎞeNX`pq[ṽTCY
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pX̐錾
+     * addPass() ԂApXg\[X錾
+     */
+    class PassBuilder final {
+    public:
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	\[X̓ǂݍ݂錾
+         * @param	resource	\[X̃nh
+         * @param	state		ǂݍ݂ɎgXe[g
+         * @return	g̎Q
+         */
+        PassBuilder& read(Handle resource, D3D12_RESOURCE_STATES state) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	\[X݂̏錾
+         * @param	resource	\[X̃nh
+         * @param	state		݂ɎgXe[g
+         * @return	g̎Q
+         */
+        PassBuilder& write(Handle resource, D3D12_RESOURCE_STATES state) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	_[^[Qbg錾
+         * 錾 OMSetRenderTargets ̃Xbg֐ݒ肷
+         * @param	resource	\[X̃nh
+         * @param	view		_[^[Qbgr[
+         * @param	clearColor	NAF(nullptr ȂNAȂ)
+         * @return	g̎Q
+         */
+        PassBuilder& renderTarget(Handle resource, D3D12_CPU_DESCRIPTOR_HANDLE view, const float* clearColor = nullptr) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	fvXobt@錾
+         * @param	resource	\[X̃nh
+         * @param	view		fvXXeVr[
+         * @param	clear		[xNA邩
+         * @param	clearDepth	NA[x
+         * @return	g̎Q
+         */
+        PassBuilder& depthStencil(Handle resource, D3D12_CPU_DESCRIPTOR_HANDLE view, bool clear = false, float clearDepth = 1.0f) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	o̓\[XɊ^ȂĂ폜ȂpXɂ
+         * @return	g̎Q
+         */
+        PassBuilder& sideEffect() noexcept;
+
+    private:
+        friend class RenderGraph;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief    RXgN^
+         * @param	graph	_[Ot
+         * @param	pass	pX̔ԍ
+         */
+        PassBuilder(RenderGraph& graph, UINT pass) noexcept
+            : graph_(graph), pass_(pass) {}
+
+    private:
+        RenderGraph& graph_;  /// _[Ot
+        UINT         pass_;   /// pX̔ԍ
+    };
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    RenderGraph() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~RenderGraph() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	錾pXƃ\[XSč폜
+     * ꎞeNX`p̃q[vƔzu\[X͎c
+     */
+    void reset() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Oō쐬\[Xo^
+     * s̃oA̓R}hXgǐՂXe[g璣̂ŁA\[X CommandList::trackResource() œo^Ă
+     * @param	name			\[X̖O
+     * @param	resource		\[X
+     * @param	initialState	OtsÕXe[g
+     * @param	finalState		Otsɖ߂Xe[g
+     * @param	output			Ot̏o͂ɂ邩(o͂Ɋ^ȂpX͍폜)
+     * @return	\[X̃nh
+     */
+    [[nodiscard]] Handle importResource(const char* name, ID3D12Resource* resource, D3D12_RESOURCE_STATES initialState, D3D12_RESOURCE_STATES finalState, bool output = false) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ꎞeNX`錾
+     * _[^[QbgfvXXeṼeNX`ɌBTCY̓foCXɖ₢킹
+     * GCAVÖ͓esȂ̂ŁAŏɎgpXŃNA邩Ŝނ
+     * @param	name		\[X̖O
+     * @param	desc		\[X̐ݒ
+     * @param	clearValue	œKꂽNAl(nullptr Ȃw肵Ȃ)
+     * @return	\[X̃nh
+     */
+    [[nodiscard]] Handle createTexture(const char* name, const D3D12_RESOURCE_DESC& desc, const D3D12_CLEAR_VALUE* clearValue = nullptr) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ꎞeNX`錾
+     * @param	name			\[X̖O
+     * @param	desc			\[X̐ݒ
+     * @param	allocationInfo	q[ṽTCYƃACg
+     * @param	clearValue		œKꂽNAl(nullptr Ȃw肵Ȃ)
+     * @return	\[X̃nh
+     */
+    [[nodiscard]] Handle createTexture(const char* name, const D3D12_RESOURCE_DESC& desc, const D3D12_RESOURCE_ALLOCATION_INFO& allocationInfo, const D3D12_CLEAR_VALUE* clearValue = nullptr) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pXǉ
+     * @param	name	pX̖O
+     * @param	execute	pX̋L^֐
+     * @return	pX̐錾
+     */
+    [[nodiscard]] PassBuilder addPass(const char* name, ExecuteFunction execute) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pX̍폜EoAEꎞeNX`̔zu߂
+     * foCX͎gȂ
+     * @return	(錾Ɍ肪 false)
+     */
+    [[nodiscard]] bool compile() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	RpCOtR}hXgɋL^
+     * @param	commandList	R}hXg
+     * @return	(ꎞeNX`̍쐬Ɏs false)
+     */
+    [[nodiscard]] bool execute(const CommandList& commandList) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X擾
+     * ꎞeNX` execute() ̂ݎ擾ł
+     * @param	handle	\[X̃nh
+     * @return	\[X̃|C^
+     */
+    [[nodiscard]] ID3D12Resource* resource(Handle handle) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pX̎s擾
+     * @return	spX̔ԍ(錾)
+     */
+    [[nodiscard]] const std::vector<UINT>& passOrder() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pX̑OɒoA擾
+     * @param	pass	pX̔ԍ
+     * @return	oA
+     */
+    [[nodiscard]] const std::vector<Barrier>& passBarriers(UINT pass) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ꎞeNX`̃q[ṽItZbg擾
+     * @param	handle	\[X̃nh
+     * @return	ItZbg(zuĂȂ UINT64 ̍ől)
+     */
+    [[nodiscard]] UINT64 heapOffset(Handle handle) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	RpCʂ̓v擾
+     * @return	v
+     */
+    [[nodiscard]] const Stats& stats() const noexcept;
+
+private:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X̃ANZX
+     */
+    struct Access {
+        Handle                resource = invalidHandle;              /// \[X̃nh
+        D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_COMMON;  /// gXe[g
+        bool                  write = false;                        /// ނ
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_[^[Qbg̐ݒ
+     */
+    struct Attachment {
+        Handle                      resource = invalidHandle;  /// \[X̃nh
+        D3D12_CPU_DESCRIPTOR_HANDLE view{};                    /// r[
+        bool                        clear = false;             /// NA邩
+        float                       clearColor[4]{};           /// NAF
+        float                       clearDepth = 1.0f;         /// NA[x
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	pX
+     */
+    struct Pass {
+        std::string             name{};              /// pX̖O
+        ExecuteFunction         execute{};           /// L^֐
+        std::vector<Access>     accesses{};          /// \[X̃ANZX
+        std::vector<Attachment> renderTargets{};     /// _[^[Qbg
+        Attachment              depthStencil{};      /// fvXobt@(resource ȂgȂ)
+        bool                    sideEffect = false;  /// o͂Ɋ^ȂĂ폜Ȃ
+        bool                    culled = false;      /// 폜
+        std::vector<Barrier>    barriers{};          /// pX̑OɒoA
+        std::vector<Handle>     discards{};          /// pX̑Oɓej郊\[X(GCAVȌ)
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X
+     */
+    struct Resource {
+        std::string                    name{};                                      /// \[X̖O
+        ID3D12Resource*                imported = nullptr;                          /// Oō쐬\[X(ꎞeNX` nullptr)
+        D3D12_RESOURCE_STATES          initialState = D3D12_RESOURCE_STATE_COMMON;  /// OtsÕXe[g(ꎞeNX`͍ŏɎgXe[g)
+        D3D12_RESOURCE_STATES          finalState = D3D12_RESOURCE_STATE_COMMON;    /// Ots̃Xe[g(ꎞeNX` initialState Ɠ)
+        bool                           output = false;                              /// Ot̏o͂
+        D3D12_RESOURCE_DESC            desc{};                                      /// ꎞeNX`̐ݒ
+        D3D12_RESOURCE_ALLOCATION_INFO allocation{};                                /// ꎞeNX`̃TCYƃACg
+        bool                           hasClearValue = false;                       /// NAlw肵
+        D3D12_CLEAR_VALUE              clearValue{};                                /// ꎞeNX`̃NAl
+        UINT                           firstPass = ~0u;                             /// ŏɎgpX̎s
+        UINT                           lastPass = 0;                                /// ŌɎgpX̎s
+        UINT64                         heapOffset = ~0ull;                          /// q[ṽItZbg
+        ID3D12Resource*                placed = nullptr;                            /// zu\[X(execute() ̂ݗL)
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	zuς݂̈ꎞeNX`
+     * ݒEItZbg̐錾Ύ̃t[łėp
+     */
+    struct PlacedResource {
+        D3D12_RESOURCE_DESC                    desc{};          /// \[X̐ݒ
+        UINT64                                 heapOffset{};    /// q[ṽItZbg
+        D3D12_RESOURCE_STATES                  initialState{};  /// 쐬̃Xe[g(Ots̃Xe[gɖ߂)
+        Microsoft::WRL::ComPtr<ID3D12Resource> resource{};      /// \[X
+        bool                                   used = false;    /// t[Ŏg
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	o͂Ɋ^ȂpX폜
+     */
+    void cullPasses() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ԂdȂȂꎞeNX`𓯂̈ɔzu
+     */
+    void placeTransients() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Xe[gJڂoA߂
+     */
+    void buildBarriers() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ꎞeNX`p̃q[vƃ\[Xpӂ
+     * @param	commandList	R}hXg
+     * @return	
+     */
+    [[nodiscard]] bool realizeTransients(const CommandList& commandList) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	oA𒣂
+     * R}hXg֑JڂvA1̌Ăяoɂ܂Ƃ߂Ĕs
+     * @param	commandList	R}hXg
+     * @param	barriers	oA
+     */
+    void issueBarriers(const CommandList& commandList, const std::vector<Barrier>& barriers) const noexcept;
+
+private:
+    std::vector<Pass>     passes_{};          /// 錾pX
+    std::vector<Resource> resources_{};       /// 錾\[X
+    std::vector<UINT>     order_{};           /// spX̔ԍ
+    std::vector<Barrier>  finalBarriers_{};   /// SpX̌ɒoA
+    Stats                 stats_{};           /// RpCʂ̓v
+    bool                  compiled_ = false;  /// RpCς݂
+
+    Microsoft::WRL::ComPtr<ID3D12Heap> heap_{};      /// ꎞeNX`p̃q[v
+    UINT64                             heapSize_{};  /// q[ṽTCY
+    std::vector<PlacedResource>        placed_{};    /// zuς݂̈ꎞeNX`
+};
@@ -0,0 +1,283 @@
+// \[XXe[gǐՃNX
+
+#include "resource_state_tracker.h"
+#include <cassert>
+
+namespace {
+    // ݂𔺂Xe[g(̃Xe[gƑgݍ킹Ȃ)
+    constexpr auto writeStates_ = D3D12_RESOURCE_STATE_RENDER_TARGET | D3D12_RESOURCE_STATE_UNORDERED_ACCESS | D3D12_RESOURCE_STATE_DEPTH_WRITE |
+                                  D3D12_RESOURCE_STATE_STREAM_OUT | D3D12_RESOURCE_STATE_COPY_DEST | D3D12_RESOURCE_STATE_RESOLVE_DEST;
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[Xo^
+ * @param	resource	\[X
+ * @param	state		݂̃Xe[g
+ */
+void ResourceStateTracker::track(ID3D12Resource* resource, D3D12_RESOURCE_STATES state) noexcept {
+    assert(resource && "o^郊\[X܂");
+    Entry entry{};
+    entry.state = state;
+    entries_[resource] = entry;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[X̓o^
+ * \[XOɌĂяo
+ * @param	resource	\[X
+ */
+void ResourceStateTracker::untrack(ID3D12Resource* resource) noexcept {
+    // 郊\[X̃oA͔sȂ
+    for (size_t i = pending_.size(); i > 0; --i) {
+        const auto& barrier = pending_[i - 1];
+        const auto* target = barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING ? barrier.Aliasing.pResourceAfter : barrier.Transition.pResource;
+        if (target == resource) {
+            erasePending(i - 1);
+        }
+    }
+    entries_.erase(resource);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[X݂̌̃Xe[g擾
+ * ߂ĂoȂJڌ̃Xe[gԂ
+ * @param	resource	\[X
+ * @return	Xe[g
+ */
+[[nodiscard]] D3D12_RESOURCE_STATES ResourceStateTracker::state(ID3D12Resource* resource) const noexcept {
+    const auto it = entries_.find(resource);
+    if (it == entries_.end()) {
+        assert(false && "o^ĂȂ\[Xł");
+        return D3D12_RESOURCE_STATE_COMMON;
+    }
+    return it->second.state;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Xe[g̑Jڂv
+ * @param	resource	\[X
+ * @param	after		Jڌ̃Xe[g
+ */
+void ResourceStateTracker::transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES after) noexcept {
+    const auto it = entries_.find(resource);
+    if (it == entries_.end()) {
+        assert(false && "o^ĂȂ\[Xł");
+        return;
+    }
+    auto& entry = it->second;
+
+    // oA̓rȂɏI
+    if (entry.splitting) {
+        assert(entry.state == after && "oA̓rŕʂ̃Xe[g֑JڂĂ܂");
+        endTransition(resource);
+        if (entry.state == after) {
+            return;
+        }
+    }
+
+    // Xe[gւ̑Jڂ͕sv
+    if (entry.state == after) {
+        ++stats_.eliminated;
+        return;
+    }
+
+    // ǂݍ݃Xe[g̑gݍ킹Ɋ܂܂ǂݍ݃Xe[gւ̑Jڂsv
+    // COMMON(PRESENT) ͒l 0 Ȃ̂ŏɑJڂ
+    const bool readOnly = (entry.state & writeStates_) == 0 && (after & writeStates_) == 0;
+    if (readOnly && after != D3D12_RESOURCE_STATE_COMMON && (entry.state & after) == after) {
+        ++stats_.eliminated;
+        return;
+    }
+
+    // sȎJڂ΁ȂJڌ̃Xe[g1ɂ܂Ƃ߂
+    if (entry.hasPending) {
+        auto& barrier = pending_[entry.pendingIndex];
+        barrier.Transition.StateAfter = after;
+        entry.state = after;
+        ++stats_.eliminated;
+
+        // ̃Xe[gɖ߂ȂJڎ̂sv
+        if (barrier.Transition.StateBefore == after) {
+            erasePending(entry.pendingIndex);
+            entry.hasPending = false;
+            ++stats_.eliminated;
+        }
+        return;
+    }
+
+    entry.hasPending = true;
+    entry.pendingIndex = pending_.size();
+    pending_.push_back(makeTransition(resource, entry.state, after, D3D12_RESOURCE_BARRIER_FLAG_NONE));
+    entry.state = after;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	oAőJڂJn
+ * endTransition() ܂ł̊Ԃ GPU Jڂi߂B̊Ԃ̓\[XgȂ
+ * @param	resource	\[X
+ * @param	after		Jڌ̃Xe[g
+ */
+void ResourceStateTracker::beginTransition(ID3D12Resource* resource, D3D12_RESOURCE_STATES after) noexcept {
+    const auto it = entries_.find(resource);
+    if (it == entries_.end()) {
+        assert(false && "o^ĂȂ\[Xł");
+        return;
+    }
+    auto& entry = it->second;
+    assert(!entry.splitting && "oA̓rł");
+
+    if (entry.state == after) {
+        ++stats_.eliminated;
+        return;
+    }
+
+    // ߂ĂJڂ͊JñoAOɔŝŁA܂Ƃ߂Ɏc
+    entry.hasPending = false;
+    entry.beginPending = true;
+    entry.pendingIndex = pending_.size();
+    pending_.push_back(makeTransition(resource, entry.state, after, D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY));
+
+    entry.splitting = true;
+    entry.splitBefore = entry.state;
+    entry.state = after;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	oȂJڂI
+ * JñoAsȂA2܂Ƃ߂Ēʏ̃oAɂ
+ * @param	resource	\[X
+ */
+void ResourceStateTracker::endTransition(ID3D12Resource* resource) noexcept {
+    const auto it = entries_.find(resource);
+    if (it == entries_.end()) {
+        assert(false && "o^ĂȂ\[Xł");
+        return;
+    }
+    auto& entry = it->second;
+    if (!entry.splitting) {
+        // JnɑJڂsvꍇ
+        return;
+    }
+    entry.splitting = false;
+
+    if (entry.beginPending) {
+        // JnƏI̊ԂɔsĂȂ̂ŕ̈ӖȂ
+        pending_[entry.pendingIndex].Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+        entry.beginPending = false;
+        entry.hasPending = true;
+        ++stats_.eliminated;
+        return;
+    }
+
+    entry.hasPending = false;
+    pending_.push_back(makeTransition(resource, entry.splitBefore, entry.state, D3D12_RESOURCE_BARRIER_FLAG_END_ONLY));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	GCAVOoAv
+ * @param	after	gn߂郊\[X
+ */
+void ResourceStateTracker::aliasing(ID3D12Resource* after) noexcept {
+    // ȍ~̑Jڂ̓GCAVOoAɔs
+    const auto it = entries_.find(after);
+    if (it != entries_.end()) {
+        it->second.hasPending = false;
+    }
+
+    D3D12_RESOURCE_BARRIER barrier{};
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    // ؂ւÕ\[X͎w肵Ȃ(̈̑SẴ\[XΏۂɂȂ)
+    barrier.Aliasing.pResourceBefore = nullptr;
+    barrier.Aliasing.pResourceAfter = after;
+    pending_.push_back(barrier);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	߂ĂoA擾
+ * @return	oA
+ */
+[[nodiscard]] const std::vector<D3D12_RESOURCE_BARRIER>& ResourceStateTracker::pending() const noexcept {
+    return pending_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	߂ĂoA𔭍sς݂ɂ
+ * pending() ̃oA ResourceBarrier ɓnɌĂяo
+ */
+void ResourceStateTracker::markIssued() noexcept {
+    if (pending_.empty()) {
+        return;
+    }
+
+    stats_.issued += static_cast<UINT>(pending_.size());
+    ++stats_.flushes;
+    pending_.clear();
+
+    // soAɂ͂܂Ƃ߂Ȃ
+    for (auto& [resource, entry] : entries_) {
+        entry.hasPending = false;
+        entry.beginPending = false;
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	v擾
+ * @return	v
+ */
+[[nodiscard]] const ResourceStateTracker::Stats& ResourceStateTracker::stats() const noexcept {
+    return stats_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	vZbg
+ */
+void ResourceStateTracker::resetStats() noexcept {
+    stats_ = {};
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Jڂ̃oA쐬
+ * @param	resource	\[X
+ * @param	before		JڑÕXe[g
+ * @param	after		Jڌ̃Xe[g
+ * @param	flags		oÃtO
+ * @return	oA
+ */
+[[nodiscard]] D3D12_RESOURCE_BARRIER ResourceStateTracker::makeTransition(ID3D12Resource* resource, D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after, D3D12_RESOURCE_BARRIER_FLAGS flags) noexcept {
+    D3D12_RESOURCE_BARRIER barrier{};
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    barrier.Flags = flags;
+    barrier.Transition.pResource = resource;
+    barrier.Transition.StateBefore = before;
+    barrier.Transition.StateAfter = after;
+    barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+    return barrier;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	߂ĂoA폜
+ * ̃oÄʒuL^Ă郊\[X͈ʒul߂
+ * @param	index	oÄʒu
+ */
+void ResourceStateTracker::erasePending(size_t index) noexcept {
+    pending_.erase(pending_.begin() + index);
+    for (auto& [resource, entry] : entries_) {
+        if ((entry.hasPending || entry.beginPending) && entry.pendingIndex > index) {
+            --entry.pendingIndex;
+        }
+    }
+}
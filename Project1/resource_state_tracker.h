@@ -0,0 +1,164 @@
+// \[XXe[gǐՃNX
+
+#pragma once
+
+#include <d3d12.h>
+#include <unordered_map>
+#include <vector>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\[XXe[gǐՃNX
+ * o^\[X݂̌̃Xe[gL^AvꂽJڂoAgݗĂė߂Ă
+ * Xe[gւ̑Jڂ͏ȂAsȎJڂ\[XɏdȂꍇ1ɂ܂Ƃ߂
+ * ߂oA CommandList ̕`NȂO1 ResourceBarrier Ŕs
+ * D3D12  API ͌ĂяoȂ̂ŁAfoCXĂ̓mFł
+ * Xe[g̓R}h̋L^ɍXV̂ŁA1̃L[ŋL^Ɏs郊\[XɎg
+ */
+class ResourceStateTracker final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	oA̓v
+     */
+    struct Stats {
+        UINT issued{};      /// soA̐
+        UINT eliminated{};  /// 璷ƂďȂoA̐
+        UINT flushes{};     /// ResourceBarrier ̌Ăяo
+    };
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    ResourceStateTracker() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~ResourceStateTracker() = default;
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[Xo^
+     * @param	resource	\[X
+     * @param	state		݂̃Xe[g
+     */
+    void track(ID3D12Resource* resource, D3D12_RESOURCE_STATES state) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X̓o^
+     * \[XOɌĂяo
+     * @param	resource	\[X
+     */
+    void untrack(ID3D12Resource* resource) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X݂̌̃Xe[g擾
+     * ߂ĂoȂJڌ̃Xe[gԂ
+     * @param	resource	\[X
+     * @return	Xe[g
+     */
+    [[nodiscard]] D3D12_RESOURCE_STATES state(ID3D12Resource* resource) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Xe[g̑Jڂv
+     * @param	resource	\[X
+     * @param	after		Jڌ̃Xe[g
+     */
+    void transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES after) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	oAőJڂJn
+     * endTransition() ܂ł̊Ԃ GPU Jڂi߂B̊Ԃ̓\[XgȂ
+     * @param	resource	\[X
+     * @param	after		Jڌ̃Xe[g
+     */
+    void beginTransition(ID3D12Resource* resource, D3D12_RESOURCE_STATES after) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	oȂJڂI
+     * JñoAsȂA2܂Ƃ߂Ēʏ̃oAɂ
+     * @param	resource	\[X
+     */
+    void endTransition(ID3D12Resource* resource) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	GCAVOoAv
+     * @param	after	gn߂郊\[X
+     */
+    void aliasing(ID3D12Resource* after) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	߂ĂoA擾
+     * @return	oA
+     */
+    [[nodiscard]] const std::vector<D3D12_RESOURCE_BARRIER>& pending() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	߂ĂoA𔭍sς݂ɂ
+     * pending() ̃oA ResourceBarrier ɓnɌĂяo
+     */
+    void markIssued() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	v擾
+     * @return	v
+     */
+    [[nodiscard]] const Stats& stats() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	vZbg
+     */
+    void resetStats() noexcept;
+
+private:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X̋L^
+     */
+    struct Entry {
+        D3D12_RESOURCE_STATES state{};         /// ݂̃Xe[g(oA̓r͑Jڌ̃Xe[g)
+        D3D12_RESOURCE_STATES splitBefore{};   /// oȂJڑÕXe[g
+        bool                  splitting{};     /// oA̓r
+        bool                  hasPending{};    /// ߂ĂJڂ̃oA邩(܂Ƃ߂)
+        bool                  beginPending{};  /// oÅJn𗭂߂Ă邩
+        size_t                pendingIndex{};  /// ߂ĂoÄʒu
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Jڂ̃oA쐬
+     * @param	resource	\[X
+     * @param	before		JڑÕXe[g
+     * @param	after		Jڌ̃Xe[g
+     * @param	flags		oÃtO
+     * @return	oA
+     */
+    [[nodiscard]] static D3D12_RESOURCE_BARRIER makeTransition(ID3D12Resource* resource, D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after, D3D12_RESOURCE_BARRIER_FLAGS flags) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	߂ĂoA폜
+     * @param	index	oÄʒu
+     */
+    void erasePending(size_t index) noexcept;
+
+private:
+    std::unordered_map<ID3D12Resource*, Entry> entries_{};  /// o^\[X
+    std::vector<D3D12_RESOURCE_BARRIER>        pending_{};  /// ߂ĂoA
+    Stats                                      stats_{};    /// v
+};
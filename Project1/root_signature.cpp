@@ -6,11 +6,15 @@
 //---------------------------------------------------------------------------------
 /**
  * @brief	[gVOl`쐬
- * @param	device	foCXNX̃CX^X
+ * @param	instanceBinding	CX^Xf[^̓n
+ * @param	instanceFormat	CX^Xf[^̌`
  * @return	 true
  */
-[[nodiscard]] bool RootSignature::create() noexcept {
+[[nodiscard]] bool RootSignature::create(InstanceBinding instanceBinding, InstanceFormat instanceFormat) noexcept {
     // `ɕKvȃ\[XVF[_ɓ`
+    // CX^Xf[^̌`̓[gp[^ɉeȂAVF[_ PSO QƂ̂łŎ
+    instanceBinding_ = instanceBinding;
+    instanceFormat_ = instanceFormat;
 
     // RX^gobt@( Xbg b0 )
     // ̏ꍇ̓J̃r[sˉes񂪓z
@@ -21,26 +25,35 @@
     r0.RegisterSpace = 0;
     r0.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
-    // RX^gobt@( Xbg b1 )
-    // ̏ꍇ̓|S̃[hsFz
-    D3D12_DESCRIPTOR_RANGE r1{};
-    r1.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
-    r1.NumDescriptors = 1;
-    r1.BaseShaderRegister = 1;  // Xbgԍ 1 ɕύX
-    r1.RegisterSpace = 0;
-    r1.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
-
     // [gp[^̐ݒ
-    constexpr auto       paramNum = 2;
-    D3D12_ROOT_PARAMETER rootParameters[paramNum]{};
-    rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-    rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;  // _VF[_[݂̂ŗp
-    rootParameters[0].DescriptorTable.NumDescriptorRanges = 1;
-    rootParameters[0].DescriptorTable.pDescriptorRanges = &r0;
-    rootParameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-    rootParameters[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;  // SẴVF[_[ŗp
-    rootParameters[1].DescriptorTable.NumDescriptorRanges = 1;
-    rootParameters[1].DescriptorTable.pDescriptorRanges = &r1;
+    constexpr auto       paramMax = 3;
+    D3D12_ROOT_PARAMETER rootParameters[paramMax]{};
+    rootParameters[sceneParameterIndex].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+    rootParameters[sceneParameterIndex].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;  // _VF[_[݂̂ŗp
+    rootParameters[sceneParameterIndex].DescriptorTable.NumDescriptorRanges = 1;
+    rootParameters[sceneParameterIndex].DescriptorTable.pDescriptorRanges = &r0;
+
+    // |S̃[hsF̓CX^Xf[^Ƃēn
+    // VertexBuffer ̏ꍇ͒_obt@œn̂Ń[gp[^͕sv
+    UINT paramNum = 1;
+    if (instanceBinding_ == InstanceBinding::StructuredBuffer) {
+        // CX^Xf[^̃XgN`[hobt@( Xbg t0 )
+        // fBXNv^g킸 GPU zAhX𒼐ڐݒ肷
+        rootParameters[instanceBufferParameterIndex].ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV;
+        rootParameters[instanceBufferParameterIndex].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+        rootParameters[instanceBufferParameterIndex].Descriptor.ShaderRegister = 0;
+        rootParameters[instanceBufferParameterIndex].Descriptor.RegisterSpace = 0;
+
+        // `斈̐擪CX^Xԍ( Xbg b1 )
+        // SV_InstanceID ɂ͕`R}h̊JnCX^Xʒu܂܂Ȃ̂Ń[g萔œn
+        rootParameters[instanceBaseParameterIndex].ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS;
+        rootParameters[instanceBaseParameterIndex].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+        rootParameters[instanceBaseParameterIndex].Constants.ShaderRegister = 1;
+        rootParameters[instanceBaseParameterIndex].Constants.RegisterSpace = 0;
+        rootParameters[instanceBaseParameterIndex].Constants.Num32BitValues = 1;
+
+        paramNum = paramMax;
+    }
 
     // [gVOl`̐ݒ
     D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc{};
@@ -91,4 +104,22 @@
     }
 
     return rootSignature_.Get();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	CX^Xf[^̓n擾
+ * @return	CX^Xf[^̓n
+ */
+[[nodiscard]] RootSignature::InstanceBinding RootSignature::instanceBinding() const noexcept {
+    return instanceBinding_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	CX^Xf[^̌`擾
+ * @return	CX^Xf[^̌`
+ */
+[[nodiscard]] RootSignature::InstanceFormat RootSignature::instanceFormat() const noexcept {
+    return instanceFormat_;
 }
\ No newline at end of file
@@ -9,6 +9,29 @@
  * @brief	[gVOl`NX
  */
 class RootSignature final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CX^Xf[^̓n
+     */
+    enum class InstanceBinding {
+        VertexBuffer,      /// _obt@(̓Xbg 1)̒_Ƃēn
+        StructuredBuffer,  /// XgN`[hobt@(t0)ɒuA`斈̐擪CfbNX[g萔(b1)œn
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CX^Xf[^̌`
+     */
+    enum class InstanceFormat {
+        Matrix,   /// [hEr[EvWFNVsƃJ[(InstanceDataA80 oCg)
+        Compact,  /// ʒuE]Eg嗦ƃJ[(CompactInstanceDataA32 oCg)B_VF[_ŕ
+    };
+
+    static constexpr UINT sceneParameterIndex = 0;           /// V[ʃRX^gobt@̃[gp[^ԍ
+    static constexpr UINT instanceBufferParameterIndex = 1;  /// CX^Xf[^̃[gp[^ԍ(StructuredBuffer ̂)
+    static constexpr UINT instanceBaseParameterIndex = 2;    /// 擪CX^Xԍ̃[gp[^ԍ(StructuredBuffer ̂)
+
 public:
     //---------------------------------------------------------------------------------
     /**
@@ -25,9 +48,11 @@ public:
     //---------------------------------------------------------------------------------
     /**
      * @brief	[gVOl`쐬
+     * @param	instanceBinding	CX^Xf[^̓n
+     * @param	instanceFormat	CX^Xf[^̌`
      * @return	 true
      */
-    [[nodiscard]] bool create() noexcept;
+    [[nodiscard]] bool create(InstanceBinding instanceBinding = InstanceBinding::StructuredBuffer, InstanceFormat instanceFormat = InstanceFormat::Matrix) noexcept;
 
     //---------------------------------------------------------------------------------
     /**
@@ -36,6 +61,22 @@ public:
      */
     [[nodiscard]] ID3D12RootSignature* get() const noexcept;
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CX^Xf[^̓n擾
+     * @return	CX^Xf[^̓n
+     */
+    [[nodiscard]] InstanceBinding instanceBinding() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CX^Xf[^̌`擾
+     * @return	CX^Xf[^̌`
+     */
+    [[nodiscard]] InstanceFormat instanceFormat() const noexcept;
+
 private:
-    Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature_{};  /// [gVOl`
+    Microsoft::WRL::ComPtr<ID3D12RootSignature> rootSignature_{};    /// [gVOl`
+    InstanceBinding                             instanceBinding_{};  /// CX^Xf[^̓n
+    InstanceFormat                              instanceFormat_{};   /// CX^Xf[^̌`
 };
@@ -3,6 +3,7 @@
 #include "shader.h"
 #include <cassert>
 #include <string>
+#include <vector>
 
 #include <D3Dcompiler.h>
 #pragma comment(lib, "d3dcompiler.lib")
@@ -10,10 +11,11 @@
 //---------------------------------------------------------------------------------
 /**
  * @brief	VF[_쐬
- * @param	device	foCXNX̃CX^X
+ * @param	rootSignature	[gVOl`(CX^Xf[^̓nƌ`ɍ킹ē͂؂ւ)
+ * @param	vertexFormat	_tH[}bg(_FƖ@̗Lɍ킹ē͂؂ւ)
  * @return	 true
  */
-[[nodiscard]] bool Shader::create() noexcept {
+[[nodiscard]] bool Shader::create(const RootSignature& rootSignature, const VertexFormat& vertexFormat) noexcept {
     // VF[_ǍARpCĐ
 
     // VF[_t@C̃pX
@@ -22,12 +24,29 @@
     // VF[_̃RpCG[Ȃǂlɂ
     ID3DBlob* error{};
 
-    auto res = D3DCompileFromFile(temp.data(), nullptr, nullptr, "vs", "vs_5_0", D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION, 0, &vertexShader_, &error);
+    // CX^Xf[^̓nƌ`A_̓͂}NŐ؂ւ
+    std::vector<D3D_SHADER_MACRO> macros{};
+    if (rootSignature.instanceBinding() == RootSignature::InstanceBinding::StructuredBuffer) {
+        macros.push_back({ "INSTANCE_STRUCTURED_BUFFER", "1" });
+    }
+    if (rootSignature.instanceFormat() == RootSignature::InstanceFormat::Compact) {
+        macros.push_back({ "INSTANCE_COMPACT", "1" });
+    }
+    if (vertexFormat.color() != VertexFormat::Color::None) {
+        macros.push_back({ "VERTEX_COLOR", "1" });
+    }
+    if (vertexFormat.normal() != VertexFormat::Normal::None) {
+        macros.push_back({ "VERTEX_NORMAL", "1" });
+    }
+    macros.push_back({ nullptr, nullptr });
+    const D3D_SHADER_MACRO* defines = macros.data();
+
+    auto res = D3DCompileFromFile(temp.data(), defines, nullptr, "vs", "vs_5_0", D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION, 0, &vertexShader_, &error);
     if (FAILED(res)) {
         char* p = static_cast<char*>(error->GetBufferPointer());
         assert(false && "_VF[_̃RpCɎs܂");
     }
-    res = D3DCompileFromFile(temp.data(), nullptr, nullptr, "ps", "ps_5_0", D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION, 0, &pixelShader_, &error);
+    res = D3DCompileFromFile(temp.data(), defines, nullptr, "ps", "ps_5_0", D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION, 0, &pixelShader_, &error);
     if (FAILED(res)) {
         char* p = static_cast<char*>(error->GetBufferPointer());
         assert(false && "sNZVF[_̃RpCɎs܂");
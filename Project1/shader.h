@@ -3,6 +3,8 @@
 #pragma once
 
 #include "device.h"
+#include "root_signature.h"
+#include "vertex_format.h"
 
 //---------------------------------------------------------------------------------
 /**
@@ -25,9 +27,11 @@ public:
     //---------------------------------------------------------------------------------
     /**
      * @brief	VF[_쐬
+     * @param	rootSignature	[gVOl`(CX^Xf[^̓nƌ`ɍ킹ē͂؂ւ)
+     * @param	vertexFormat	_tH[}bg(_FƖ@̗Lɍ킹ē͂؂ւ)
      * @return	 true
      */
-    [[nodiscard]] bool create() noexcept;
+    [[nodiscard]] bool create(const RootSignature& rootSignature, const VertexFormat& vertexFormat = VertexFormat()) noexcept;
 
     //---------------------------------------------------------------------------------
     /**
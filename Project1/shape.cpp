@@ -2,7 +2,25 @@
 
 #include "shape.h"
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 
+namespace {
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	v~eBug|W[ D3D12 ̒lɕϊ
+     * @param	topology	v~eBug|W[
+     * @return	D3D12 ̃v~eBug|W[
+     */
+    [[nodiscard]] D3D_PRIMITIVE_TOPOLOGY toD3D(PrimitiveTopology topology) noexcept {
+        switch (topology) {
+            case PrimitiveTopology::TriangleList: return D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+            case PrimitiveTopology::TriangleStrip: return D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+        }
+        assert(false && "Ή̃v~eBug|W[ł");
+        return D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+    }
+}  // namespace
 
 //---------------------------------------------------------------------------------
 /**
@@ -10,30 +28,166 @@
  * @return	 true
  */
 [[nodiscard]] bool Shape::create() noexcept {
-    // _obt@̐
-    if (!createVertexBuffer()) {
-        return false;
-    }
-    // CfbNXobt@̐
-    if (!createIndexBuffer()) {
+    const auto geometry = this->geometry();
+    if (!geometry.vertices || geometry.vertexCount == 0 || !geometry.indices || geometry.indexCount == 0) {
+        assert(false && "`̃f[^܂");
         return false;
     }
 
+    // _W狫E{[vZ
+    // ϊO̒_WvẐŁAi[`ɂ덷͊܂܂Ȃ
+    computeBounds(&geometry.vertices[0].position, geometry.vertexCount, sizeof(VertexFormat::SourceVertex));
+
+    topology_ = toD3D(geometry.topology);
+    vertexFormat_ = geometry.format;
+    // snorm16 ̍W AABB  -1 ` 1 ɐKĊi[
+    positionRange_ = vertexFormat_.positionRange(bounds_.boxCenter, bounds_.boxExtents);
+
     return true;
 }
 
 //---------------------------------------------------------------------------------
 /**
  * @brief	|S̕`
- * @param	commandList	R}hXg
+ * L_obt@ƃCfbNXobt@ ShapeContainer ݒ肷
+ * @param	commandList		R}hXg
+ * @param	instanceCount	CX^X
+ * @param	startInstance	CX^Xf[^̊Jnʒu
  */
-void Shape::draw(const CommandList& commandList) noexcept {
-    // _obt@̐ݒ
-    commandList.get()->IASetVertexBuffers(0, 1, &vertexBufferView_);
-    // CfbNXobt@̐ݒ
-    commandList.get()->IASetIndexBuffer(&indexBufferView_);
+void Shape::draw(const CommandList& commandList, UINT instanceCount, UINT startInstance) noexcept {
     // v~eBu`̐ݒ
-    commandList.get()->IASetPrimitiveTopology(topology_);
-    // `R}h
-    commandList.get()->DrawIndexedInstanced(indexCount_, 1, 0, 0, 0);
+    // O̕`Ɠꍇ͐ݒς݂Ȃ̂ŏȂ
+    commandList.setPrimitiveTopology(topology_);
+    // `R}h(߂ĂoAΐɔs)
+    // Lobt@̈ʒu͊JnCfbNXƃx[X_Ŏw肷
+    commandList.drawIndexedInstanced(drawRange_.indexCount, instanceCount, drawRange_.startIndex, static_cast<INT>(drawRange_.baseVertex), startInstance);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	[JԂ̋E{[擾
+ * @return	E{[
+ */
+[[nodiscard]] const Shape::Bounds& Shape::bounds() const noexcept {
+    return bounds_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_tH[}bg擾
+ * @return	_tH[}bg
+ */
+[[nodiscard]] const VertexFormat& Shape::vertexFormat() const noexcept {
+    return vertexFormat_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	W̊i[͈͂擾
+ * @return	W̊i[͈
+ */
+[[nodiscard]] const VertexFormat::PositionRange& Shape::positionRange() const noexcept {
+    return positionRange_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Lobt@̕`͈͂擾
+ * @return	`͈
+ */
+[[nodiscard]] const ShapeDrawRange& Shape::drawRange() const noexcept {
+    return drawRange_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	v~eBug|W[擾
+ * @return	v~eBug|W[
+ */
+[[nodiscard]] D3D_PRIMITIVE_TOPOLOGY Shape::topology() const noexcept {
+    return topology_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Lobt@̕`͈͂ݒ
+ * @param	range	`͈
+ */
+void Shape::setDrawRange(const ShapeDrawRange& range) noexcept {
+    drawRange_ = range;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_W狫E{[vZ
+ * @param	positions	擪_̍W
+ * @param	count		_
+ * @param	stride		1_̃TCY
+ */
+void Shape::computeBounds(const DirectX::XMFLOAT3* positions, size_t count, size_t stride) noexcept {
+    using namespace DirectX;
+
+    if (count == 0) {
+        bounds_ = {};
+        return;
+    }
+
+    const auto* bytes = reinterpret_cast<const std::byte*>(positions);
+    auto position = [bytes, stride](size_t i) {
+        return XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(bytes + i * stride));
+    };
+
+    // AABB
+    XMVECTOR boxMin = position(0);
+    XMVECTOR boxMax = boxMin;
+    for (size_t i = 1; i < count; ++i) {
+        boxMin = XMVectorMin(boxMin, position(i));
+        boxMax = XMVectorMax(boxMax, position(i));
+    }
+    const XMVECTOR boxCenter = XMVectorScale(XMVectorAdd(boxMin, boxMax), 0.5f);
+    XMStoreFloat3(&bounds_.boxCenter, boxCenter);
+    XMStoreFloat3(&bounds_.boxExtents, XMVectorScale(XMVectorSubtract(boxMax, boxMin), 0.5f));
+
+    // AABB ̒S𒆐SƂ鋫E
+    float boxRadius = 0.0f;
+    for (size_t i = 0; i < count; ++i) {
+        boxRadius = (std::max)(boxRadius, XMVectorGetX(XMVector3Length(XMVectorSubtract(position(i), boxCenter))));
+    }
+
+    // Ritter @ɂ鋫Ei`ɂĂ͂̕Ȃj
+    auto farthest = [&](FXMVECTOR from) {
+        size_t index = 0;
+        float  maxDistance = -1.0f;
+        for (size_t i = 0; i < count; ++i) {
+            const float distance = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(position(i), from)));
+            if (distance > maxDistance) {
+                maxDistance = distance;
+                index = i;
+            }
+        }
+        return position(index);
+    };
+    const XMVECTOR a = farthest(position(0));
+    const XMVECTOR b = farthest(a);
+    XMVECTOR center = XMVectorScale(XMVectorAdd(a, b), 0.5f);
+    float    radius = XMVectorGetX(XMVector3Length(XMVectorSubtract(b, a))) * 0.5f;
+    for (size_t i = 0; i < count; ++i) {
+        const XMVECTOR toPoint = XMVectorSubtract(position(i), center);
+        const float    distance = XMVectorGetX(XMVector3Length(toPoint));
+        if (distance > radius) {
+            // _܂ނ悤ɋL
+            const float newRadius = (radius + distance) * 0.5f;
+            center = XMVectorAdd(center, XMVectorScale(toPoint, (newRadius - radius) / distance));
+            radius = newRadius;
+        }
+    }
+
+    if (radius < boxRadius) {
+        XMStoreFloat3(&bounds_.sphereCenter, center);
+        bounds_.sphereRadius = radius;
+    }
+    else {
+        XMStoreFloat3(&bounds_.sphereCenter, boxCenter);
+        bounds_.sphereRadius = boxRadius;
+    }
 }
\ No newline at end of file
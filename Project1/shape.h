@@ -4,21 +4,25 @@
 
 #include "device.h"
 #include "command_list.h"
+#include "shape_types.h"
 #include <DirectXMath.h>
 
 //---------------------------------------------------------------------------------
 /**
  * @brief	`x[XNX
+ * `̃f[^^ shape_types.h ɒuAD3D12 ̌^ւ̕ῗ̃NXōs
  */
 class Shape {
 public:
     //---------------------------------------------------------------------------------
     /**
-     * @brief	RX^gobt@pf[^\
+     * @brief	E{[
      */
-    struct ConstBufferData {
-        DirectX::XMMATRIX world_{};  /// [hs
-        DirectX::XMFLOAT4 color_{};  /// J[(RGBA)
+    struct Bounds {
+        DirectX::XMFLOAT3 sphereCenter{};  /// E̒S
+        float             sphereRadius{};  /// E̔a
+        DirectX::XMFLOAT3 boxCenter{};     /// AABB ̒S
+        DirectX::XMFLOAT3 boxExtents{};    /// AABB ̊e̔̒
     };
 
 public:
@@ -37,6 +41,7 @@ public:
     //---------------------------------------------------------------------------------
     /**
      * @brief	|S̐
+     * E{[ȂǂvZBGPU ̃obt@ ShapeContainer ܂Ƃ߂č쐬
      * @return	 true
      */
     [[nodiscard]] bool create() noexcept;
@@ -44,30 +49,79 @@ public:
     //---------------------------------------------------------------------------------
     /**
      * @brief	|S̕`
-     * @param	commandList	R}hXg
+     * L_obt@ƃCfbNXobt@ ShapeContainer ݒ肷
+     * @param	commandList		R}hXg
+     * @param	instanceCount	CX^X
+     * @param	startInstance	CX^Xf[^̊Jnʒu
      */
-    void draw(const CommandList& commandList) noexcept;
+    void draw(const CommandList& commandList, UINT instanceCount, UINT startInstance) noexcept;
 
-protected:
     //---------------------------------------------------------------------------------
     /**
-     * @brief	_obt@̐
-     * @return	 true
+     * @brief	[JԂ̋E{[擾
+     * @return	E{[
      */
-    [[nodiscard]] virtual bool createVertexBuffer() noexcept = 0;
+    [[nodiscard]] const Bounds& bounds() const noexcept;
 
     //---------------------------------------------------------------------------------
     /**
-     * @brief	CfbNXobt@̐
-     * @return	 true
+     * @brief	_f[^ƃCfbNXf[^擾
+     * @return	`̃f[^
+     */
+    [[nodiscard]] virtual ShapeGeometry geometry() const noexcept = 0;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_tH[}bg擾
+     * tH[}bǧ`͒_obt@L
+     * @return	_tH[}bg
+     */
+    [[nodiscard]] const VertexFormat& vertexFormat() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	W̊i[͈͂擾
+     * _obt@̍W͈͂̔͂ŐKĊi[̂ŁACX^X̕ϊɊ܂߂ĕ`悷
+     * @return	W̊i[͈
+     */
+    [[nodiscard]] const VertexFormat::PositionRange& positionRange() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Lobt@̕`͈͂擾
+     * @return	`͈
+     */
+    [[nodiscard]] const ShapeDrawRange& drawRange() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	v~eBug|W[擾
+     * @return	v~eBug|W[
+     */
+    [[nodiscard]] D3D_PRIMITIVE_TOPOLOGY topology() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Lobt@̕`͈͂ݒ
+     * ShapeContainer f[^Lobt@֒ǉƂɐݒ肷
+     * @param	range	`͈
+     */
+    void setDrawRange(const ShapeDrawRange& range) noexcept;
+
+protected:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_W狫E{[vZ
+     * @param	positions	擪_̍W
+     * @param	count		_
+     * @param	stride		1_̃TCY
      */
-    [[nodiscard]] virtual bool createIndexBuffer() noexcept = 0;
+    void computeBounds(const DirectX::XMFLOAT3* positions, size_t count, size_t stride) noexcept;
 
 protected:
-    Microsoft::WRL::ComPtr<ID3D12Resource> vertexBuffer_{};      /// _obt@
-    Microsoft::WRL::ComPtr<ID3D12Resource> indexBuffer_{};       /// CfbNXobt@
-    D3D12_VERTEX_BUFFER_VIEW               vertexBufferView_{};  /// _obt@r[
-    D3D12_INDEX_BUFFER_VIEW                indexBufferView_{};   /// CfbNXobt@r[
-    D3D_PRIMITIVE_TOPOLOGY                 topology_{};          /// v~eBug|W[
-    UINT                                   indexCount_{};        /// CfbNX
+    D3D_PRIMITIVE_TOPOLOGY      topology_{};       /// v~eBug|W[
+    VertexFormat                vertexFormat_{};   /// _tH[}bg
+    VertexFormat::PositionRange positionRange_{};  /// W̊i[͈
+    ShapeDrawRange              drawRange_{};      /// Lobt@̕`͈
+    Bounds                      bounds_{};         /// [JԂ̋E{[
 };
\ No newline at end of file
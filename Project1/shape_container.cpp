@@ -1,20 +1,270 @@
 // `ReiNX
 
 #include "shape_container.h"
+#include "upload_manager.h"
+#include "deferred_release.h"
+#include <cassert>
+#include <cstring>
 
 
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ǉꂽ`̃f[^Lobt@֓]
+ * `̑Oɖt[ĂяoB] UploadManager ̃Rs[L[ōsAobt@獷ւ
+ */
+void ShapeContainer::commit() noexcept {
+	for (auto& [key, pool] : vertexPools_) {
+		// ]obt@֍ւ
+		if (completeUpload(pool.pending_, pool.buffer_)) {
+			pool.view_.BufferLocation = pool.buffer_->GetGPUVirtualAddress();
+			pool.view_.SizeInBytes = pool.pending_.size_;
+			pool.view_.StrideInBytes = pool.stride_;
+		}
+
+		// f[^Lobt@蒼
+		// `̒ǉ͏قƂǂȂ̂ŁAŜ]
+		const auto size = static_cast<UINT>(pool.data_.size());
+		if (!pool.pending_.buffer_ && pool.view_.SizeInBytes != size) {
+			if (!beginUpload(pool.data_.data(), size, pool.pending_)) {
+				// Lobt@쐬łȂꍇ͎̃t[ōĎs
+				return;
+			}
+		}
+	}
+
+	if (completeUpload(indexPending_, indexBuffer_)) {
+		indexBufferView_.BufferLocation = indexBuffer_->GetGPUVirtualAddress();
+		indexBufferView_.SizeInBytes = indexPending_.size_;
+		indexBufferView_.Format = DXGI_FORMAT_R16_UINT;
+	}
+
+	const auto indexSize = static_cast<UINT>(indexData_.size() * sizeof(uint16_t));
+	if (!indexPending_.buffer_ && indexBufferView_.SizeInBytes != indexSize) {
+		if (!beginUpload(indexData_.data(), indexSize, indexPending_)) {
+			return;
+		}
+	}
+}
+
 //---------------------------------------------------------------------------------
 /**
  * @brief	|S̕`
+ * @param	commandList		R}hXg
+ * @param	id				`󎯕ʎq
+ * @param	instanceCount	CX^X
+ * @param	startInstance	CX^Xf[^̊Jnʒu
+ */
+void ShapeContainer::draw(const CommandList& commandList, UINT64 id, UINT instanceCount, UINT startInstance) noexcept {
+	// w肳ꂽ`󂪑݂ȂꍇƓ]ςłȂ`͉Ȃ
+	const auto binding = drawBinding(id);
+	if (!binding) {
+		return;
+	}
+
+	// _tH[}bǧ`͓obt@ĝŁA`󂪕ςĂĐݒ͏Ȃ
+	bind(commandList, binding.value());
+
+	shapes_.find(id)->second->draw(commandList, instanceCount, startInstance);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	``悷邽߂̃obt@Ɣ͈͂擾
+ * ExecuteIndirect ̈gݗĂꍇɎg
+ * @param	id	`󎯕ʎq
+ * @return	obt@Ɣ͈(`󂪑݂ȂꍇƓ]ςłȂꍇ nullopt)
+ */
+[[nodiscard]] std::optional<ShapeContainer::DrawBinding> ShapeContainer::drawBinding(UINT64 id) const noexcept {
+	auto it = shapes_.find(id);
+	if (it == shapes_.end()) {
+		return std::nullopt;
+	}
+	const auto& shape = *it->second;
+
+	auto pool = vertexPools_.find(shape.vertexFormat().key());
+	if (pool == vertexPools_.end()) {
+		return std::nullopt;
+	}
+
+	// ]ςłȂ`͕`悵Ȃ
+	const auto& range = shape.drawRange();
+	if ((range.baseVertex + range.vertexCount) * pool->second.stride_ > pool->second.view_.SizeInBytes ||
+		(range.startIndex + range.indexCount) * sizeof(uint16_t) > indexBufferView_.SizeInBytes) {
+		return std::nullopt;
+	}
+
+	return DrawBinding{ pool->second.view_, shape.topology(), range };
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	``悷obt@ƃv~eBug|W[ݒ肷
  * @param	commandList	R}hXg
- * @param	`󎯕ʎq
+ * @param	binding		drawBinding() Ŏ擾obt@Ɣ͈
+ */
+void ShapeContainer::bind(const CommandList& commandList, const DrawBinding& binding) const noexcept {
+	commandList.setVertexBuffer(0, binding.vertexBuffer);
+	commandList.setIndexBuffer(indexBufferView_);
+	commandList.setPrimitiveTopology(binding.topology);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`̃[JԂ̋E{[擾
+ * @param	id	`󎯕ʎq
+ * @return	E{[(`󂪑݂Ȃꍇ nullopt)
  */
-void ShapeContainer::draw(const CommandList& commandList, UINT64 id) noexcept {
+[[nodiscard]] std::optional<Shape::Bounds> ShapeContainer::bounds(UINT64 id) const noexcept {
 	auto it = shapes_.find(id);
 	if (it == shapes_.end()) {
-		// w肳ꂽ`󂪑݂Ȃꍇ͉Ȃ
-		return;
+		return std::nullopt;
+	}
+
+	return it->second->bounds();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`̒_f[^ƃCfbNXf[^擾
+ * @param	id	`󎯕ʎq
+ * @return	`̃f[^(`󂪑݂Ȃꍇ nullopt)
+ */
+[[nodiscard]] std::optional<ShapeGeometry> ShapeContainer::geometry(UINT64 id) const noexcept {
+	auto it = shapes_.find(id);
+	if (it == shapes_.end()) {
+		return std::nullopt;
 	}
 
-	it->second->draw(commandList);
+	auto geometry = it->second->geometry();
+	geometry.positionRange = it->second->positionRange();
+	return geometry;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`̍W̊i[͈͂擾
+ * @param	id	`󎯕ʎq
+ * @return	W̊i[͈(`󂪑݂Ȃꍇ nullopt)
+ */
+[[nodiscard]] std::optional<VertexFormat::PositionRange> ShapeContainer::positionRange(UINT64 id) const noexcept {
+	auto it = shapes_.find(id);
+	if (it == shapes_.end()) {
+		return std::nullopt;
+	}
+
+	return it->second->positionRange();
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`̓o^ԍ擾
+ * @param	id	`󎯕ʎq
+ * @return	o^ԍ(`󂪑݂Ȃꍇ nullopt)
+ */
+[[nodiscard]] std::optional<UINT> ShapeContainer::index(UINT64 id) const noexcept {
+	auto it = indices_.find(id);
+	if (it == indices_.end()) {
+		return std::nullopt;
+	}
+
+	return it->second;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`̃f[^Lobt@ CPU ֒̕ǉ
+ * _f[^͌`̒_tH[}bg֕ϊĊi[
+ * @param	shape	`
+ */
+void ShapeContainer::addGeometry(Shape& shape) noexcept {
+	const auto geometry = shape.geometry();
+	auto&      pool = vertexPools_[geometry.format.key()];
+	pool.stride_ = geometry.format.stride();
+
+	// _f[^ƃCfbNXf[^𖖔֒ǉÄʒu`ɋL^
+	ShapeDrawRange range{};
+	range.baseVertex = static_cast<UINT>(pool.data_.size() / pool.stride_);
+	range.vertexCount = geometry.vertexCount;
+	range.startIndex = static_cast<UINT>(indexData_.size());
+	range.indexCount = geometry.indexCount;
+
+	geometry.format.encode(geometry.vertices, geometry.vertexCount, shape.positionRange(), pool.data_);
+	indexData_.insert(indexData_.end(), geometry.indices, geometry.indices + geometry.indexCount);
+
+	shape.setDrawRange(range);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ftHgq[vɃobt@쐬ăf[^̓]n߂
+ * @param	data	f[^
+ * @param	size	f[^̃TCY
+ * @param	pending	]̃obt@̊i[
+ * @return	 true
+ */
+[[nodiscard]] bool ShapeContainer::beginUpload(const void* data, UINT size, PendingBuffer& pending) noexcept {
+	// GPU ݂̂ANZXftHgq[vɍ쐬
+	D3D12_HEAP_PROPERTIES heapProperty{};
+	heapProperty.Type = D3D12_HEAP_TYPE_DEFAULT;
+	heapProperty.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+	heapProperty.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+	heapProperty.CreationNodeMask = 1;
+	heapProperty.VisibleNodeMask = 1;
+
+	D3D12_RESOURCE_DESC resourceDesc{};
+	resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+	resourceDesc.Alignment = 0;
+	resourceDesc.Width = size;
+	resourceDesc.Height = 1;
+	resourceDesc.DepthOrArraySize = 1;
+	resourceDesc.MipLevels = 1;
+	resourceDesc.Format = DXGI_FORMAT_UNKNOWN;
+	resourceDesc.SampleDesc.Count = 1;
+	resourceDesc.SampleDesc.Quality = 0;
+	resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+	resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+	Microsoft::WRL::ComPtr<ID3D12Resource> newBuffer{};
+	auto res = Device::instance().get()->CreateCommittedResource(
+		&heapProperty,
+		D3D12_HEAP_FLAG_NONE,
+		&resourceDesc,
+		D3D12_RESOURCE_STATE_COMMON,  // Rs[L[ COPY_DEST ցA`掞ɓǂݎXe[gֈÖٓIɏi
+		nullptr,
+		IID_PPV_ARGS(&newBuffer));
+	if (FAILED(res)) {
+		assert(false && "Lobt@̍쐬Ɏs");
+		return false;
+	}
+
+	// Rs[L[ł̓]L^(M UploadManager::submit() ł܂Ƃ߂čs)
+	const auto ticket = UploadManager::instance().uploadBuffer(newBuffer.Get(), 0, data, size);
+	if (!ticket) {
+		return false;
+	}
+
+	pending.buffer_ = std::move(newBuffer);
+	pending.ticket_ = *ticket;
+	pending.size_ = size;
+
+	return true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	]Ă΁A]̃obt@gp̃obt@ƍւ
+ * @param	pending	]̃obt@
+ * @param	buffer	gp̃obt@(Âobt@͒x)
+ * @return	ւ true
+ */
+[[nodiscard]] bool ShapeContainer::completeUpload(PendingBuffer& pending, Microsoft::WRL::ComPtr<ID3D12Resource>& buffer) noexcept {
+	if (!pending.buffer_ || !UploadManager::instance().isComplete(pending.ticket_)) {
+		return false;
+	}
+
+	// Âobt@͑Õt[Ŏgp̉\̂Œx
+	DeferredRelease::instance().release(std::move(buffer));
+	buffer = std::move(pending.buffer_);
+
+	return true;
 }
\ No newline at end of file
@@ -3,15 +3,32 @@
 #pragma once
 
 #include "shape.h"
+#include "upload_manager.h"
 #include <unordered_map>
 #include <memory>
+#include <optional>
+#include <vector>
 #include<typeinfo>
 
 //---------------------------------------------------------------------------------
 /**
  * @brief	`ReiNX
+ * S`̒_f[^𒸓_tH[}bg1̒_obt@ցACfbNXf[^1̃CfbNXobt@ւ܂Ƃ߂
+ * obt@̓ftHgq[vɍ쐬ăRs[L[œ]A`͋Lobt@̈ʒuŕ`悷
  */
 class ShapeContainer final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	``悷邽߂̃obt@Ɣ͈
+     * _obt@ƃv~eBug|W[`́Aݒςɑĕ`ł
+     */
+    struct DrawBinding {
+        D3D12_VERTEX_BUFFER_VIEW vertexBuffer{};  /// L_obt@̃r[
+        D3D_PRIMITIVE_TOPOLOGY   topology{};      /// v~eBug|W[
+        ShapeDrawRange           range{};         /// Lobt@̕`͈
+    };
+
 public:
     //---------------------------------------------------------------------------------
     /**
@@ -43,18 +60,84 @@ public:
             return 0;
         }
 
+        // Lobt@փf[^ǉ
+        addGeometry(*p);
+
+        // `揇̃\[gL[pɓo^̔ԍU
+        indices_.emplace(id, static_cast<UINT>(indices_.size()));
         shapes_.emplace(id, std::move(p));
         return id;
     }
 
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ǉꂽ`̃f[^Lobt@֓]
+     * `̑Oɖt[ĂяoB] UploadManager ̃Rs[L[ōsAobt@獷ւ
+     */
+    void commit() noexcept;
+
     //---------------------------------------------------------------------------------
     /**
      * @brief	|S̕`
+     * ]ςłȂ`͕`悵Ȃ
+     * @param	commandList		R}hXg
+     * @param	id				`󎯕ʎq
+     * @param	instanceCount	CX^X
+     * @param	startInstance	CX^Xf[^̊Jnʒu
+     */
+    void draw(const CommandList& commandList, UINT64 id, UINT instanceCount = 1, UINT startInstance = 0) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	``悷邽߂̃obt@Ɣ͈͂擾
+     * ExecuteIndirect ̈gݗĂꍇɎg
+     * @param	id	`󎯕ʎq
+     * @return	obt@Ɣ͈(`󂪑݂ȂꍇƓ]ςłȂꍇ nullopt)
+     */
+    [[nodiscard]] std::optional<DrawBinding> drawBinding(UINT64 id) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	``悷obt@ƃv~eBug|W[ݒ肷
      * @param	commandList	R}hXg
-     * @param	`󎯕ʎq
+     * @param	binding		drawBinding() Ŏ擾obt@Ɣ͈
+     */
+    void bind(const CommandList& commandList, const DrawBinding& binding) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`̃[JԂ̋E{[擾
+     * @param	id	`󎯕ʎq
+     * @return	E{[(`󂪑݂Ȃꍇ nullopt)
+     */
+    [[nodiscard]] std::optional<Shape::Bounds> bounds(UINT64 id) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`̒_f[^ƃCfbNXf[^擾
+     * CPU Ō`ꍇ(ՕJOȂ)ɎgBW̊i[͈͂ݒ肷
+     * @param	id	`󎯕ʎq
+     * @return	`̃f[^(`󂪑݂Ȃꍇ nullopt)
+     */
+    [[nodiscard]] std::optional<ShapeGeometry> geometry(UINT64 id) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`̍W̊i[͈͂擾
+     * @param	id	`󎯕ʎq
+     * @return	W̊i[͈(`󂪑݂Ȃꍇ nullopt)
+     */
+    [[nodiscard]] std::optional<VertexFormat::PositionRange> positionRange(UINT64 id) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`̓o^ԍ擾
+     * `󎯕ʎq̓nbVlȂ̂ŁA\[gL[ȂǏȂrbgŌ`\ꍇɎg
+     * @param	id	`󎯕ʎq
+     * @return	o^ԍ(`󂪑݂Ȃꍇ nullopt)
      */
-    void draw(const CommandList& commandList, UINT64 id) noexcept;
+    [[nodiscard]] std::optional<UINT> index(UINT64 id) const noexcept;
 
 private:
     //---------------------------------------------------------------------------------
@@ -78,6 +161,60 @@ private:
     ShapeContainer(ShapeContainer&&) = delete;
     ShapeContainer& operator=(ShapeContainer&&) = delete;
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`̃f[^Lobt@ CPU ֒̕ǉ
+     * @param	shape	`
+     */
+    void addGeometry(Shape& shape) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Rs[L[œ]̃obt@
+     */
+    struct PendingBuffer {
+        Microsoft::WRL::ComPtr<ID3D12Resource> buffer_{};  /// ]̃obt@(]łȂ΋)
+        UploadManager::Ticket                  ticket_{};  /// ]̃`Pbg
+        UINT                                   size_{};    /// ]TCY
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ftHgq[vɃobt@쐬ăf[^̓]n߂
+     * @param	data	f[^
+     * @param	size	f[^̃TCY
+     * @param	pending	]̃obt@̊i[
+     * @return	 true
+     */
+    [[nodiscard]] static bool beginUpload(const void* data, UINT size, PendingBuffer& pending) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	]Ă΁A]̃obt@gp̃obt@ƍւ
+     * @param	pending	]̃obt@
+     * @param	buffer	gp̃obt@(Âobt@͒x)
+     * @return	ւ true
+     */
+    [[nodiscard]] static bool completeUpload(PendingBuffer& pending, Microsoft::WRL::ComPtr<ID3D12Resource>& buffer) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_tH[}bg̋L_obt@
+     */
+    struct VertexPool {
+        UINT                                   stride_{};   /// 1_̃TCY
+        std::vector<std::byte>                 data_{};     /// S`̒_f[^(CPU ̕)
+        Microsoft::WRL::ComPtr<ID3D12Resource> buffer_{};   /// L_obt@
+        D3D12_VERTEX_BUFFER_VIEW               view_{};     /// _obt@r[(]ς݂͈̔)
+        PendingBuffer                          pending_{};  /// ]̒_obt@
+    };
+
 protected:
-    std::unordered_map<UINT64, std::unique_ptr<Shape>> shapes_;  /// `Rei
+    std::unordered_map<UINT64, std::unique_ptr<Shape>> shapes_;             /// `Rei
+    std::unordered_map<UINT64, UINT>                   indices_{};          /// `󖈂̓o^ԍ
+    std::unordered_map<UINT, VertexPool>               vertexPools_{};      /// _tH[}bg̋L_obt@
+    std::vector<uint16_t>                              indexData_{};        /// S`̃CfbNXf[^(CPU ̕)
+    Microsoft::WRL::ComPtr<ID3D12Resource>             indexBuffer_{};      /// LCfbNXobt@
+    D3D12_INDEX_BUFFER_VIEW                            indexBufferView_{};  /// CfbNXobt@r[(]ς݂͈̔)
+    PendingBuffer                                      indexPending_{};     /// ]̃CfbNXobt@
 };
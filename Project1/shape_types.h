@@ -0,0 +1,71 @@
+// `̃f[^^
+// D3D12 ɈˑȂ̂ŁA\tgEFA`IN[WJOƋ Windows ȊOłrhł
+// D3D12 ̌^ւ̕ϊ Shape Ȃǂ Windows p̃t@Cōs
+
+#pragma once
+
+#include "vertex_format.h"
+#include <DirectXMath.h>
+#include <DirectXPackedVector.h>
+#include <cstdint>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	v~eBug|W[
+ */
+enum class PrimitiveTopology : uint8_t {
+    TriangleList,   /// Op`Xg
+    TriangleStrip,  /// Op`Xgbv
+};
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	CX^X̒_f[^\
+ * ̓CAEg̃Xbg 1 ɑΉ
+ * s̓[hsɃr[sƃvWFNVsZς݂ŁA_VF[_1̏Zŕϊ
+ */
+struct InstanceData {
+    DirectX::XMFLOAT4X4 worldViewProjection_{};  /// [hEr[EvWFNVs
+    DirectX::XMFLOAT4   color_{};                /// J[(RGBA)
+};
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	kCX^X̒_f[^\
+ * InstanceData ̑Ɏg 32 oCǧ`B_VF[_Ń[hs𕜌
+ * g嗦 half Ȃ̂ŁA65504 𒴂lׂ[͕\Ȃ
+ */
+struct CompactInstanceData {
+    DirectX::XMFLOAT3                position_{};  /// ʒu
+    DirectX::PackedVector::XMUBYTEN4 color_{};     /// J[(RGBA8)
+    DirectX::PackedVector::XMSHORTN4 rotation_{};  /// ](PʃNH[^jIAsnorm16)
+    DirectX::PackedVector::XMHALF4   scale_{};     /// g嗦(w ͖gp)
+};
+static_assert(sizeof(CompactInstanceData) == 32, "kCX^Xf[^̃TCYVF[_ƈv܂");
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`̒_f[^ƃCfbNXf[^
+ * f[^͌`󂪑݂ԗLł邱
+ * W̊i[͈͂ ShapeContainer::geometry() `̒lݒ肷(͕ϊȂ)
+ */
+struct ShapeGeometry {
+    const VertexFormat::SourceVertex* vertices{};       /// _f[^(ϊO)
+    uint32_t                          vertexCount{};    /// _
+    VertexFormat                      format{};         /// _obt@Ɋi[tH[}bg
+    VertexFormat::PositionRange       positionRange{};  /// W̊i[͈
+    const uint16_t*                   indices{};        /// CfbNXf[^
+    uint32_t                          indexCount{};     /// CfbNX
+    PrimitiveTopology                 topology{};       /// v~eBug|W[
+};
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Lobt@̕`͈
+ */
+struct ShapeDrawRange {
+    uint32_t baseVertex{};   /// L_obt@̐擪_
+    uint32_t vertexCount{};  /// _
+    uint32_t startIndex{};   /// LCfbNXobt@̐擪CfbNX
+    uint32_t indexCount{};   /// CfbNX
+};
@@ -0,0 +1,447 @@
+// \tgEFA`NX
+
+#include "software_renderer.h"
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <execution>
+#include <fstream>
+
+namespace {
+    constexpr float minClipW_ = 1.0e-4f;  // `悷钸_̃NbvW w ̉iO͋߃Nbvʂ܂Ƃ݂Ȃj
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	0 ` 1 ̒l unorm8 ɕϊ
+     * @param	value	l
+     * @return	ϊl
+     */
+    [[nodiscard]] uint32_t toUnorm8(float value) noexcept {
+        return static_cast<uint32_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	F RGBA8 ɕϊ
+     * @param	color	F
+     * @return	RGBA8 ̐F(R ʃoCg)
+     */
+    [[nodiscard]] uint32_t packColor(const DirectX::XMFLOAT4& color) noexcept {
+        return toUnorm8(color.x) | (toUnorm8(color.y) << 8) | (toUnorm8(color.z) << 16) | (toUnorm8(color.w) << 24);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`̐Fɍ
+     * F SRC_ALPHA / INV_SRC_ALPHAAAt@ ONE / ZERO ō
+     * @param	destination	` RGBA8 ̐F
+     * @param	source		`悷F
+     * @return	 RGBA8 ̐F
+     */
+    [[nodiscard]] uint32_t blend(uint32_t destination, const DirectX::XMFLOAT4& source) noexcept {
+        const float alpha = std::clamp(source.w, 0.0f, 1.0f);
+        const float rgb[] = { source.x, source.y, source.z };
+
+        uint32_t result = toUnorm8(source.w) << 24;
+        for (uint32_t i = 0; i < 3; ++i) {
+            const float dst = static_cast<float>((destination >> (i * 8)) & 0xff) / 255.0f;
+            result |= toUnorm8(rgb[i] * alpha + dst * (1.0f - alpha)) << (i * 8);
+        }
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	NH[^jIŃxNg]
+     * _VF[_ rotateByQuaternion() ƓŌvZ
+     * @param	v	xNg
+     * @param	q	NH[^jI
+     * @return	]xNg
+     */
+    [[nodiscard]] DirectX::XMVECTOR XM_CALLCONV rotateByQuaternion(DirectX::FXMVECTOR v, DirectX::FXMVECTOR q) noexcept {
+        using namespace DirectX;
+        const XMVECTOR inner = XMVectorMultiplyAdd(XMVectorSplatW(q), v, XMVector3Cross(q, v));
+        return XMVectorMultiplyAdd(XMVectorReplicate(2.0f), XMVector3Cross(q, inner), v);
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`쐬
+ * @param	width	(4 ̔{)
+ * @param	height	
+ * @return	̐
+ */
+[[nodiscard]] bool SoftwareRenderer::create(uint32_t width, uint32_t height) noexcept {
+    // 1s 4 sNZ̂ŁA 4 ̔{Ɍ
+    if (width == 0 || height == 0 || width % 4 != 0) {
+        assert(false && "\tgEFA`̕`̃TCYsł");
+        return false;
+    }
+
+    width_ = width;
+    height_ = height;
+    tileCountX_ = (width + tileWidth - 1) / tileWidth;
+    tileCountY_ = (height + tileHeight - 1) / tileHeight;
+
+    color_.assign(size_t(width) * height, 0);
+    depth_.assign(size_t(width) * height, 1.0f);
+    triangles_.clear();
+    bins_.assign(size_t(tileCountX_) * tileCountY_, {});
+    stats_ = {};
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`NA
+ * U蕪ς݂Ŗ`̎Op`͔j
+ * @param	color	NAF
+ * @param	depth	NA[x
+ */
+void SoftwareRenderer::clear(const float (&color)[4], float depth) noexcept {
+    std::fill(color_.begin(), color_.end(), packColor({ color[0], color[1], color[2], color[3] }));
+    std::fill(depth_.begin(), depth_.end(), depth);
+
+    triangles_.clear();
+    for (auto& bin : bins_) {
+        bin.clear();
+    }
+    stats_ = {};
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`CX^X`悷
+ * _VF[_ƓA_ɃCX^X̃[hEr[EvWFNVs|
+ * @param	geometry		`̃f[^
+ * @param	instances		CX^Xf[^(s͍W̊i[͈͂̕ϊ܂ރ[hEr[EvWFNVs)
+ * @param	instanceCount	CX^X
+ */
+void SoftwareRenderer::draw(const ShapeGeometry& geometry, const InstanceData* instances, uint32_t instanceCount) noexcept {
+    using namespace DirectX;
+
+    for (uint32_t instance = 0; instance < instanceCount; ++instance) {
+        const XMMATRIX transform = XMLoadFloat4x4(&instances[instance].worldViewProjection_);
+        addInstance(geometry, instances[instance].color_, [&transform](const XMFLOAT3& position) {
+            return XMVector3Transform(XMLoadFloat3(&position), transform);
+        });
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`kCX^Xf[^ŃCX^X`悷
+ * _VF[_ƓAgE]EsړŃ[hϊĂr[EvWFNVϊ
+ * @param	geometry		`̃f[^
+ * @param	instances		kCX^Xf[^(W̊i[͈͂̕ϊ܂)
+ * @param	instanceCount	CX^X
+ * @param	viewProjection	r[sƃvWFNVsZs
+ */
+void XM_CALLCONV SoftwareRenderer::draw(const ShapeGeometry& geometry, const CompactInstanceData* instances, uint32_t instanceCount,
+    DirectX::FXMMATRIX viewProjection) noexcept {
+    using namespace DirectX;
+    using namespace DirectX::PackedVector;
+
+    const XMMATRIX matrix = viewProjection;
+    for (uint32_t instance = 0; instance < instanceCount; ++instance) {
+        // ̓AZuƓKŕ(snorm16  -1 ŖOaAhalf  w ͎gȂ)
+        const auto&    data = instances[instance];
+        const XMVECTOR translation = XMLoadFloat3(&data.position_);
+        const XMVECTOR rotation = XMLoadShortN4(&data.rotation_);
+        const XMVECTOR scale = XMLoadHalf4(&data.scale_);
+        XMFLOAT4       color{};
+        XMStoreFloat4(&color, XMLoadUByteN4(&data.color_));
+
+        addInstance(geometry, color, [&](const XMFLOAT3& position) {
+            const XMVECTOR world = XMVectorAdd(rotateByQuaternion(XMVectorMultiply(XMLoadFloat3(&position), scale), rotation), translation);
+            return XMVector3Transform(world, matrix);
+        });
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	1CX^X̎Op`^C֐U蕪
+ * @param	geometry	`̃f[^
+ * @param	color		CX^X̐F
+ * @param	transform	_VF[_󂯎钸_WNbvW֕ϊ֐
+ */
+template <class Transform>
+void SoftwareRenderer::addInstance(const ShapeGeometry& geometry, const DirectX::XMFLOAT4& color, const Transform& transform) noexcept {
+    using namespace DirectX;
+
+    const bool     strip = geometry.topology == PrimitiveTopology::TriangleStrip;
+    const uint32_t step = strip ? 1 : 3;
+
+    // _XN[W֕ϊ
+    // W͒_obt@Ɋi[l(i[͈͂ŐKĊۂ߂l)ɂĂϊ
+    auto toScreen = [this, &geometry, &transform](const XMFLOAT3& position, XMFLOAT3& screen) {
+        const XMVECTOR clip = transform(geometry.format.quantizePosition(position, geometry.positionRange));
+        const float    w = XMVectorGetW(clip);
+        if (w < minClipW_) {
+            return false;
+        }
+        const float invW = 1.0f / w;
+        screen.x = (XMVectorGetX(clip) * invW * 0.5f + 0.5f) * width_;
+        screen.y = (0.5f - XMVectorGetY(clip) * invW * 0.5f) * height_;
+        screen.z = XMVectorGetZ(clip) * invW;
+        return true;
+    };
+
+    for (uint32_t i = 0; i + 2 < geometry.indexCount; i += step) {
+        Triangle triangle{};
+        triangle.color = color;
+        bool valid = true;
+        for (uint32_t j = 0; j < 3 && valid; ++j) {
+            valid = toScreen(geometry.vertices[geometry.indices[i + j]].position, triangle.vertices[j]);
+        }
+        if (valid) {
+            addTriangle(triangle);
+        }
+    }
+
+    ++stats_.instances;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	U蕪Op``悷
+ * ^CɕɁAdraw() Ă񂾏ŕ`悷
+ */
+void SoftwareRenderer::resolve() noexcept {
+    if (triangles_.empty()) {
+        return;
+    }
+
+    // ^Cm͏ݐ悪dȂȂ̂ŕɕ`悷
+    std::for_each(std::execution::par, bins_.begin(), bins_.end(), [this](const std::vector<uint32_t>& bin) {
+        rasterizeTile(static_cast<uint32_t>(&bin - bins_.data()));
+    });
+
+    triangles_.clear();
+    for (auto& bin : bins_) {
+        bin.clear();
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	F PPM(P6)`ŏo
+ * At@͏oȂ
+ * @param	path	ot@C̃pX
+ * @return	
+ */
+[[nodiscard]] bool SoftwareRenderer::writePpm(const char* path) const noexcept {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        assert(false && "ot@CJ܂ł");
+        return false;
+    }
+
+    file << "P6\n" << width_ << " " << height_ << "\n255\n";
+
+    std::vector<char> row(size_t(width_) * 3);
+    for (uint32_t y = 0; y < height_; ++y) {
+        const uint32_t* pixels = color_.data() + size_t(y) * width_;
+        for (uint32_t x = 0; x < width_; ++x) {
+            row[x * 3 + 0] = static_cast<char>(pixels[x] & 0xff);
+            row[x * 3 + 1] = static_cast<char>((pixels[x] >> 8) & 0xff);
+            row[x * 3 + 2] = static_cast<char>((pixels[x] >> 16) & 0xff);
+        }
+        file.write(row.data(), static_cast<std::streamsize>(row.size()));
+    }
+
+    return static_cast<bool>(file);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	F擾
+ * @return	RGBA8 ̐F(1sNZ 32 rbgAR ʃoCg)
+ */
+[[nodiscard]] const std::vector<uint32_t>& SoftwareRenderer::color() const noexcept {
+    return color_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	[x擾
+ * @return	[x
+ */
+[[nodiscard]] const std::vector<float>& SoftwareRenderer::depth() const noexcept {
+    return depth_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	擾
+ * @return	
+ */
+[[nodiscard]] uint32_t SoftwareRenderer::width() const noexcept {
+    return width_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	擾
+ * @return	
+ */
+[[nodiscard]] uint32_t SoftwareRenderer::height() const noexcept {
+    return height_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	O clear() ̓v擾
+ * @return	v
+ */
+[[nodiscard]] const SoftwareRenderer::Stats& SoftwareRenderer::stats() const noexcept {
+    return stats_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Op`^C֐U蕪
+ * @param	triangle	XN[W̎Op`
+ */
+void SoftwareRenderer::addTriangle(const Triangle& triangle) noexcept {
+    const auto& v = triangle.vertices;
+    const float minX = (std::min)({ v[0].x, v[1].x, v[2].x });
+    const float maxX = (std::max)({ v[0].x, v[1].x, v[2].x });
+    const float minY = (std::min)({ v[0].y, v[1].y, v[2].y });
+    const float maxY = (std::max)({ v[0].y, v[1].y, v[2].y });
+    if (maxX < 0.0f || minX >= width_ || maxY < 0.0f || minY >= height_) {
+        return;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(triangles_.size());
+    triangles_.push_back(triangle);
+    ++stats_.triangles;
+
+    const uint32_t tx0 = static_cast<uint32_t>((std::max)(0.0f, minX)) / tileWidth;
+    const uint32_t tx1 = (std::min)(static_cast<uint32_t>(maxX), width_ - 1) / tileWidth;
+    const uint32_t ty0 = static_cast<uint32_t>((std::max)(0.0f, minY)) / tileHeight;
+    const uint32_t ty1 = (std::min)(static_cast<uint32_t>(maxY), height_ - 1) / tileHeight;
+    for (uint32_t ty = ty0; ty <= ty1; ++ty) {
+        for (uint32_t tx = tx0; tx <= tx1; ++tx) {
+            bins_[ty * tileCountX_ + tx].push_back(index);
+        }
+    }
+    stats_.binned += (tx1 - tx0 + 1) * (ty1 - ty0 + 1);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	^CɐU蕪Op``悷
+ * ӊ֐Ɛ[xsNZW1ŕ\A4 sNZ[xeXg
+ * ӏ̃sNZ͍K1̎Op`Ɋ܂߂
+ * @param	tile	^Cԍ
+ */
+void SoftwareRenderer::rasterizeTile(uint32_t tile) noexcept {
+    using namespace DirectX;
+
+    const uint32_t tileX = (tile % tileCountX_) * tileWidth;
+    const uint32_t tileY = (tile / tileCountX_) * tileHeight;
+    const uint32_t tileRight = (std::min)(tileX + tileWidth, width_);
+    const uint32_t tileBottom = (std::min)(tileY + tileHeight, height_);
+
+    const XMVECTOR pixelOffset = XMVectorSet(0.5f, 1.5f, 2.5f, 3.5f);
+    const XMVECTOR zero = XMVectorZero();
+
+    for (const auto index : bins_[tile]) {
+        const auto& triangle = triangles_[index];
+        XMFLOAT3    v[3] = { triangle.vertices[0], triangle.vertices[1], triangle.vertices[2] };
+
+        // ʐςɂȂɑ(ʃJOȂ)
+        float area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[1].y - v[0].y) * (v[2].x - v[0].x);
+        if (area < 0.0f) {
+            std::swap(v[1], v[2]);
+            area = -area;
+        }
+        if (area < FLT_EPSILON) {
+            continue;
+        }
+
+        // ӊ֐ e = a * x + b * y + c (_ i ̑ΕӁA)
+        // ӂƏӂ e == 0 ̃sNZ܂߂
+        float a[3];
+        float b[3];
+        float c[3];
+        bool  topLeft[3];
+        for (uint32_t i = 0; i < 3; ++i) {
+            const auto& from = v[(i + 1) % 3];
+            const auto& to = v[(i + 2) % 3];
+            a[i] = from.y - to.y;
+            b[i] = to.x - from.x;
+            c[i] = -(a[i] * from.x + b[i] * from.y);
+            topLeft[i] = a[i] > 0.0f || (a[i] == 0.0f && b[i] > 0.0f);
+        }
+
+        // [x͕ӊ֐ŏdݕt_̐[x
+        const float invArea = 1.0f / area;
+        const float za = (a[0] * v[0].z + a[1] * v[1].z + a[2] * v[2].z) * invArea;
+        const float zb = (b[0] * v[0].z + b[1] * v[1].z + b[2] * v[2].z) * invArea;
+        const float zc = (c[0] * v[0].z + c[1] * v[1].z + c[2] * v[2].z) * invArea;
+
+        // ^C̕`͈( 4 sNZPʂɑ)
+        const float    minX = (std::min)({ v[0].x, v[1].x, v[2].x });
+        const float    maxX = (std::max)({ v[0].x, v[1].x, v[2].x });
+        const float    minY = (std::min)({ v[0].y, v[1].y, v[2].y });
+        const float    maxY = (std::max)({ v[0].y, v[1].y, v[2].y });
+        const uint32_t x0 = (std::max)(tileX, static_cast<uint32_t>((std::max)(0.0f, minX))) & ~3u;
+        const uint32_t x1 = (std::min)(tileRight, static_cast<uint32_t>((std::max)(0.0f, maxX)) + 1);
+        const uint32_t y0 = (std::max)(tileY, static_cast<uint32_t>((std::max)(0.0f, minY)));
+        const uint32_t y1 = (std::min)(tileBottom, static_cast<uint32_t>((std::max)(0.0f, maxY)) + 1);
+
+        const bool     opaque = triangle.color.w >= 1.0f;
+        const uint32_t packed = packColor(triangle.color);
+
+        const XMVECTOR edgeStep[] = { XMVectorReplicate(a[0] * 4.0f), XMVectorReplicate(a[1] * 4.0f), XMVectorReplicate(a[2] * 4.0f) };
+        const XMVECTOR depthStep = XMVectorReplicate(za * 4.0f);
+
+        for (uint32_t y = y0; y < y1; ++y) {
+            const float    py = static_cast<float>(y) + 0.5f;
+            const XMVECTOR px = XMVectorAdd(XMVectorReplicate(static_cast<float>(x0)), pixelOffset);
+            XMVECTOR       edge[3];
+            for (uint32_t i = 0; i < 3; ++i) {
+                edge[i] = XMVectorMultiplyAdd(px, XMVectorReplicate(a[i]), XMVectorReplicate(b[i] * py + c[i]));
+            }
+            XMVECTOR depth = XMVectorMultiplyAdd(px, XMVectorReplicate(za), XMVectorReplicate(zb * py + zc));
+
+            float*    depthRow = depth_.data() + size_t(y) * width_;
+            uint32_t* colorRow = color_.data() + size_t(y) * width_;
+            for (uint32_t x = x0; x < x1; x += 4) {
+                // 3 ӂ̓Ő[xeXgɒʂsNZ߂
+                XMVECTOR mask = XMVectorTrueInt();
+                for (uint32_t i = 0; i < 3; ++i) {
+                    mask = XMVectorAndInt(mask, topLeft[i] ? XMVectorGreaterOrEqual(edge[i], zero) : XMVectorGreater(edge[i], zero));
+                }
+                auto*          depthPixels = reinterpret_cast<XMFLOAT4*>(depthRow + x);
+                const XMVECTOR current = XMLoadFloat4(depthPixels);
+                mask = XMVectorAndInt(mask, XMVectorLess(depth, current));
+
+                // ʂsNZF(͉fP)
+                // ͐[x܂Ȃ
+                if (opaque) {
+                    XMStoreFloat4(depthPixels, XMVectorSelect(current, depth, mask));
+                }
+                uint32_t bits[4];
+                XMStoreInt4(bits, mask);
+                for (uint32_t i = 0; i < 4; ++i) {
+                    if (bits[i]) {
+                        colorRow[x + i] = opaque ? packed : blend(colorRow[x + i], triangle.color);
+                    }
+                }
+
+                for (uint32_t i = 0; i < 3; ++i) {
+                    edge[i] = XMVectorAdd(edge[i], edgeStep[i]);
+                }
+                depth = XMVectorAdd(depth, depthStep);
+            }
+        }
+    }
+}
@@ -0,0 +1,186 @@
+// \tgEFA`NX
+
+#pragma once
+
+#include "shape_types.h"
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	\tgEFA`NX
+ * GPU g킸 CPU Ō``悷QƗp̕`
+ * GameObjectManager::drawSoftware()  D3D12 ̕`Ɠ`揇ECX^Xf[^ŕ`悷
+ * _W͌`̒_tH[}bgAkCX^Xf[^͒_VF[_Ɠxŕ
+ * F RGBA8A[x float ŕێAPPM `ŏoĕ`挋ʂ̔rɎg
+ * Op`̓^C֐U蕪A^Cɕɕ`悷B1s 4 sNZ SIMD ŏ
+ * pCvCƓA[xeXg LESSAʃJOȂAAt@uh SRC_ALPHA / INV_SRC_ALPHA
+ * (At@ 1 )̃CX^X͐[x܂Ȃ
+ * ߃Nbvʂ܂Op`̓Nbvɕ`悵Ȃ
+ */
+class SoftwareRenderer final {
+public:
+    static constexpr uint32_t tileWidth = 32;   /// ^C̕(4 ̔{)
+    static constexpr uint32_t tileHeight = 32;  /// ^C̍
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`̓v
+     */
+    struct Stats {
+        uint32_t instances{};  /// `悵CX^X
+        uint32_t triangles{};  /// ^C֐U蕪Op`̐
+        uint32_t binned{};     /// ^C֐U蕪א
+    };
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    SoftwareRenderer() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~SoftwareRenderer() = default;
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`쐬
+     * @param	width	(4 ̔{)
+     * @param	height	
+     * @return	̐
+     */
+    [[nodiscard]] bool create(uint32_t width, uint32_t height) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`NA
+     * U蕪ς݂Ŗ`̎Op`͔j
+     * @param	color	NAF
+     * @param	depth	NA[x
+     */
+    void clear(const float (&color)[4], float depth = 1.0f) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`CX^X`悷
+     * Op`XN[W֕ϊă^C֐U蕪B` resolve() ōs
+     * @param	geometry		`̃f[^
+     * @param	instances		CX^Xf[^(s͍W̊i[͈͂̕ϊ܂ރ[hEr[EvWFNVs)
+     * @param	instanceCount	CX^X
+     */
+    void draw(const ShapeGeometry& geometry, const InstanceData* instances, uint32_t instanceCount) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`kCX^Xf[^ŃCX^X`悷
+     * _VF[_ƓAgE]EsړŃ[hϊĂr[EvWFNVϊ
+     * @param	geometry		`̃f[^
+     * @param	instances		kCX^Xf[^(W̊i[͈͂̕ϊ܂)
+     * @param	instanceCount	CX^X
+     * @param	viewProjection	r[sƃvWFNVsZs
+     */
+    void XM_CALLCONV draw(const ShapeGeometry& geometry, const CompactInstanceData* instances, uint32_t instanceCount,
+        DirectX::FXMMATRIX viewProjection) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	U蕪Op``悷
+     * ^CɕɁAdraw() Ă񂾏ŕ`悷
+     */
+    void resolve() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	F PPM(P6)`ŏo
+     * At@͏oȂ
+     * @param	path	ot@C̃pX
+     * @return	
+     */
+    [[nodiscard]] bool writePpm(const char* path) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	F擾
+     * @return	RGBA8 ̐F(1sNZ 32 rbgAR ʃoCg)
+     */
+    [[nodiscard]] const std::vector<uint32_t>& color() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[x擾
+     * @return	[x
+     */
+    [[nodiscard]] const std::vector<float>& depth() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	擾
+     * @return	
+     */
+    [[nodiscard]] uint32_t width() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	擾
+     * @return	
+     */
+    [[nodiscard]] uint32_t height() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	O clear() ̓v擾
+     * @return	v
+     */
+    [[nodiscard]] const Stats& stats() const noexcept;
+
+private:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	XN[W̎Op`
+     */
+    struct Triangle {
+        DirectX::XMFLOAT3 vertices[3]{};  /// _(x, y ̓sNZAz  0 ` 1 ̐[x)
+        DirectX::XMFLOAT4 color{};        /// CX^X̐F
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Op`^C֐U蕪
+     * @param	triangle	XN[W̎Op`
+     */
+    void addTriangle(const Triangle& triangle) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	1CX^X̎Op`^C֐U蕪
+     * @param	geometry	`̃f[^
+     * @param	color		CX^X̐F
+     * @param	transform	_VF[_󂯎钸_WNbvW֕ϊ֐
+     */
+    template <class Transform>
+    void addInstance(const ShapeGeometry& geometry, const DirectX::XMFLOAT4& color, const Transform& transform) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	^CɐU蕪Op``悷
+     * @param	tile	^Cԍ
+     */
+    void rasterizeTile(uint32_t tile) noexcept;
+
+private:
+    uint32_t                           width_{};       /// 
+    uint32_t                           height_{};      /// 
+    uint32_t                           tileCountX_{};  /// ̃^C
+    uint32_t                           tileCountY_{};  /// c̃^C
+    std::vector<uint32_t>              color_{};       /// F
+    std::vector<float>                 depth_{};       /// [x(OقǏ)
+    std::vector<Triangle>              triangles_{};   /// U蕪Op`
+    std::vector<std::vector<uint32_t>> bins_{};        /// ^C̎Op`̔ԍ
+    Stats                              stats_{};       /// v
+};
@@ -0,0 +1,507 @@
+// ԕObhNX
+
+#include "spatial_grid.h"
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace {
+    constexpr int32_t cellCoordBits_ = 21;                                 // Z̃L[Ɋi[1̃rbg
+    constexpr int32_t cellCoordBias_ = 1 << (cellCoordBits_ - 1);          // ZW𕄍Ȃɂ邽߂̃oCAX
+    constexpr UINT64  cellCoordMask_ = (UINT64{ 1 } << cellCoordBits_) - 1;  // Z̃L[1̃}XN
+}  // namespace
+
+namespace game {
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Z̑傫ݒ肷
+     * @param	cellSize	Z̈ӂ̒
+     */
+    void SpatialGrid::setCellSize(float cellSize) noexcept {
+        assert(cellSize > 0.0f && "Z̑傫sł");
+        cellSize_ = cellSize;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Obh\z
+     * @param	objects	o^IuWFNg([hԂ̋E{[XVς݂ł邱)
+     */
+    void SpatialGrid::build(const std::vector<GameObject*>& objects) noexcept {
+        entries_.clear();
+        refs_.clear();
+        cells_.clear();
+        if (objects.empty()) {
+            return;
+        }
+
+        constexpr auto int32Max = (std::numeric_limits<int32_t>::max)();
+        constexpr auto int32Min = (std::numeric_limits<int32_t>::min)();
+        bounds_ = { { int32Max, int32Max, int32Max }, { int32Min, int32Min, int32Min } };
+
+        entries_.reserve(objects.size());
+        for (auto object : objects) {
+            const auto& bounds = object->worldBounds();
+
+            Entry entry{};
+            entry.object = object;
+            entry.handle = object->handle();
+            entry.typeId = object->typeId();
+            entry.layer = layerBit(object->collisionLayer());
+            entry.sphere = { bounds.sphereCenter.x, bounds.sphereCenter.y, bounds.sphereCenter.z, bounds.sphereRadius };
+            entry.boxCenter = bounds.boxCenter;
+            entry.boxExtents = bounds.boxExtents;
+            entry.cellCenter[0] = toCell(bounds.sphereCenter.x);
+            entry.cellCenter[1] = toCell(bounds.sphereCenter.y);
+            entry.cellCenter[2] = toCell(bounds.sphereCenter.z);
+
+            // E AABB ̗܂ޔ͈͂̃Zɓo^
+            const auto sphereCenter = DirectX::XMLoadFloat3(&bounds.sphereCenter);
+            const auto sphereExtents = DirectX::XMVectorReplicate(bounds.sphereRadius);
+            const auto boxCenter = DirectX::XMLoadFloat3(&bounds.boxCenter);
+            const auto boxExtents = DirectX::XMLoadFloat3(&bounds.boxExtents);
+            const auto lower = DirectX::XMVectorMin(DirectX::XMVectorSubtract(sphereCenter, sphereExtents), DirectX::XMVectorSubtract(boxCenter, boxExtents));
+            const auto upper = DirectX::XMVectorMax(DirectX::XMVectorAdd(sphereCenter, sphereExtents), DirectX::XMVectorAdd(boxCenter, boxExtents));
+            const auto half = DirectX::XMVectorReplicate(0.5f);
+
+            CellRange range{};
+            toCellRange(DirectX::XMVectorMultiply(DirectX::XMVectorAdd(lower, upper), half), DirectX::XMVectorMultiply(DirectX::XMVectorSubtract(upper, lower), half), range);
+            const auto index = static_cast<UINT32>(entries_.size());
+            for (int32_t x = range.min[0]; x <= range.max[0]; ++x) {
+                for (int32_t y = range.min[1]; y <= range.max[1]; ++y) {
+                    for (int32_t z = range.min[2]; z <= range.max[2]; ++z) {
+                        refs_.emplace_back(cellKey(x, y, z), index);
+                    }
+                }
+            }
+            for (int axis = 0; axis < 3; ++axis) {
+                entry.cellMin[axis] = range.min[axis];
+                bounds_.min[axis] = (std::min)(bounds_.min[axis], range.min[axis]);
+                bounds_.max[axis] = (std::max)(bounds_.max[axis], range.max[axis]);
+            }
+            entries_.emplace_back(entry);
+        }
+
+        // L[ɕׂāAL[͈̔͂ZƂ
+        std::sort(refs_.begin(), refs_.end());
+        for (size_t begin = 0; begin < refs_.size();) {
+            const auto key = refs_[begin].first;
+            Cell cell{};
+            cell.begin = static_cast<uint32_t>(begin);
+            size_t end = begin;
+            for (; end < refs_.size() && refs_[end].first == key; ++end) {
+                cell.layers |= entries_[refs_[end].second].layer;
+            }
+            cell.count = static_cast<uint32_t>(end - begin);
+            cells_.emplace(key, cell);
+            begin = end;
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ObhNA
+     */
+    void SpatialGrid::clear() noexcept {
+        entries_.clear();
+        refs_.clear();
+        cells_.clear();
+
+        entries_.shrink_to_fit();
+        refs_.shrink_to_fit();
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CƌIuWFNg߂Ɏ擾
+     * ͋EŔ肷
+     * @param	origin		C̎n_
+     * @param	direction	C̕
+     * @param	maxDistance	C̒
+     * @param	filter		i荞ݏ
+     * @param	hits		ʂ̏ݐ
+     * @param	capacity	ݐ̗vf
+     * @return	񂾌ʂ̐
+     */
+    size_t SpatialGrid::raycast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction, float maxDistance,
+        const QueryFilter& filter, QueryHit* hits, size_t capacity) const noexcept {
+        if (capacity == 0 || entries_.empty() || maxDistance <= 0.0f) {
+            return 0;
+        }
+
+        const auto rayOrigin = DirectX::XMLoadFloat3(&origin);
+        const auto rayDirection = DirectX::XMLoadFloat3(&direction);
+        if (DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(rayDirection)) <= 0.0f) {
+            return 0;
+        }
+        DirectX::XMFLOAT3 normalized{};
+        DirectX::XMStoreFloat3(&normalized, DirectX::XMVector3Normalize(rayDirection));
+        const float p[3] = { origin.x, origin.y, origin.z };
+        const float d[3] = { normalized.x, normalized.y, normalized.z };
+
+        // Co^͈͂ɐ؂l߂
+        float tEnter = 0.0f;
+        float tExit = maxDistance;
+        for (int axis = 0; axis < 3; ++axis) {
+            const float lower = static_cast<float>(bounds_.min[axis]) * cellSize_;
+            const float upper = static_cast<float>(bounds_.max[axis] + 1) * cellSize_;
+            if (d[axis] == 0.0f) {
+                if (p[axis] < lower || p[axis] > upper) {
+                    return 0;
+                }
+                continue;
+            }
+            float t0 = (lower - p[axis]) / d[axis];
+            float t1 = (upper - p[axis]) / d[axis];
+            if (t0 > t1) {
+                std::swap(t0, t1);
+            }
+            tEnter = (std::max)(tEnter, t0);
+            tExit = (std::min)(tExit, t1);
+            if (tEnter > tExit) {
+                return 0;
+            }
+        }
+
+        // Cʉ߂Zn_珇ɒH
+        constexpr auto infinity = std::numeric_limits<float>::infinity();
+        int32_t cell[3]{};
+        int32_t step[3]{};
+        float   tMax[3]{};
+        float   tDelta[3]{};
+        for (int axis = 0; axis < 3; ++axis) {
+            cell[axis] = std::clamp(toCell(p[axis] + d[axis] * tEnter), bounds_.min[axis], bounds_.max[axis]);
+            if (d[axis] > 0.0f) {
+                step[axis] = 1;
+                tMax[axis] = (static_cast<float>(cell[axis] + 1) * cellSize_ - p[axis]) / d[axis];
+                tDelta[axis] = cellSize_ / d[axis];
+            }
+            else if (d[axis] < 0.0f) {
+                step[axis] = -1;
+                tMax[axis] = (static_cast<float>(cell[axis]) * cellSize_ - p[axis]) / d[axis];
+                tDelta[axis] = -cellSize_ / d[axis];
+            }
+            else {
+                tMax[axis] = infinity;
+                tDelta[axis] = infinity;
+            }
+        }
+
+        const auto direction3 = DirectX::XMLoadFloat3(&normalized);
+        size_t count = 0;
+        for (;;) {
+            const float tNext = (std::min)({ tMax[0], tMax[1], tMax[2] });
+
+            const Cell* current = findCell(cell[0], cell[1], cell[2]);
+            if (current && (current->layers & filter.layers) != 0) {
+                for (uint32_t i = current->begin; i < current->begin + current->count; ++i) {
+                    const Entry& entry = entries_[refs_[i].second];
+                    if (!matches(entry, filter)) {
+                        continue;
+                    }
+
+                    // Zɓo^ꂽIuWFNg͈xǉ
+                    const auto found = std::find_if(hits, hits + count, [&entry](const QueryHit& hit) { return hit.handle == entry.handle; });
+                    if (found != hits + count) {
+                        continue;
+                    }
+
+                    // CƋĚ
+                    const auto m = DirectX::XMVectorSubtract(rayOrigin, DirectX::XMLoadFloat4(&entry.sphere));
+                    const float b = DirectX::XMVectorGetX(DirectX::XMVector3Dot(m, direction3));
+                    const float c = DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(m)) - entry.sphere.w * entry.sphere.w;
+                    if (c > 0.0f && b > 0.0f) {
+                        continue;
+                    }
+                    const float discriminant = b * b - c;
+                    if (discriminant < 0.0f) {
+                        continue;
+                    }
+                    const float distance = (std::max)(-b - std::sqrt(discriminant), 0.0f);
+                    if (distance > maxDistance) {
+                        continue;
+                    }
+
+                    // ɑ}(ꂽꍇ͍ł̂̂Ă)
+                    if (count == capacity) {
+                        if (hits[count - 1].distance <= distance) {
+                            continue;
+                        }
+                        --count;
+                    }
+                    size_t insert = count;
+                    for (; insert > 0 && hits[insert - 1].distance > distance; --insert) {
+                        hits[insert] = hits[insert - 1];
+                    }
+                    hits[insert] = { entry.handle, distance };
+                    ++count;
+                }
+            }
+
+            // ʂ܂ĂāAłʂ̃ZOȂȍ~̃Zׂ͒Ȃ
+            if (count == capacity && hits[count - 1].distance <= tNext) {
+                break;
+            }
+            if (tNext > tExit) {
+                break;
+            }
+
+            int axis = 0;
+            if (tMax[1] < tMax[axis]) {
+                axis = 1;
+            }
+            if (tMax[2] < tMax[axis]) {
+                axis = 2;
+            }
+            cell[axis] += step[axis];
+            if (cell[axis] < bounds_.min[axis] || cell[axis] > bounds_.max[axis]) {
+                break;
+            }
+            tMax[axis] += tDelta[axis];
+        }
+
+        return count;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ƏdȂIuWFNg擾
+     * @param	center		̒S
+     * @param	radius		̔a
+     * @param	filter		i荞ݏ
+     * @param	handles		ʂ̏ݐ
+     * @param	capacity	ݐ̗vf
+     * @return	񂾌ʂ̐
+     */
+    size_t SpatialGrid::overlapSphere(const DirectX::XMFLOAT3& center, float radius,
+        const QueryFilter& filter, UINT64* handles, size_t capacity) const noexcept {
+        if (capacity == 0 || entries_.empty()) {
+            return 0;
+        }
+
+        const auto sphereCenter = DirectX::XMLoadFloat3(&center);
+        CellRange range{};
+        toCellRange(sphereCenter, DirectX::XMVectorReplicate(radius), range);
+
+        size_t count = 0;
+        visitCells(range, filter.layers, [&](const Entry& entry) {
+            if (!matches(entry, filter)) {
+                return true;
+            }
+            const float hitRadius = radius + entry.sphere.w;
+            const auto offset = DirectX::XMVectorSubtract(sphereCenter, DirectX::XMLoadFloat4(&entry.sphere));
+            if (DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(offset)) < hitRadius * hitRadius) {
+                handles[count++] = entry.handle;
+            }
+            return count < capacity;
+        });
+
+        return count;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	AABB ƏdȂIuWFNg擾
+     * @param	center		AABB ̒S
+     * @param	extents		AABB ̊e̔̒
+     * @param	filter		i荞ݏ
+     * @param	handles		ʂ̏ݐ
+     * @param	capacity	ݐ̗vf
+     * @return	񂾌ʂ̐
+     */
+    size_t SpatialGrid::overlapBox(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents,
+        const QueryFilter& filter, UINT64* handles, size_t capacity) const noexcept {
+        if (capacity == 0 || entries_.empty()) {
+            return 0;
+        }
+
+        const auto boxCenter = DirectX::XMLoadFloat3(&center);
+        const auto boxExtents = DirectX::XMLoadFloat3(&extents);
+        CellRange range{};
+        toCellRange(boxCenter, boxExtents, range);
+
+        size_t count = 0;
+        visitCells(range, filter.layers, [&](const Entry& entry) {
+            if (!matches(entry, filter)) {
+                return true;
+            }
+            const auto distance = DirectX::XMVectorAbs(DirectX::XMVectorSubtract(boxCenter, DirectX::XMLoadFloat3(&entry.boxCenter)));
+            const auto limit = DirectX::XMVectorAdd(boxExtents, DirectX::XMLoadFloat3(&entry.boxExtents));
+            if (DirectX::XMVector3LessOrEqual(distance, limit)) {
+                handles[count++] = entry.handle;
+            }
+            return count < capacity;
+        });
+
+        return count;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	߂ k ̃IuWFNg擾
+     * ͋E̒Ső
+     * @param	position	̒S
+     * @param	filter		i荞ݏ
+     * @param	hits		ʂ̏ݐ
+     * @param	k			擾鐔(ݐ̗vf)
+     * @return	񂾌ʂ̐
+     */
+    size_t SpatialGrid::nearest(const DirectX::XMFLOAT3& position,
+        const QueryFilter& filter, QueryHit* hits, size_t k) const noexcept {
+        if (k == 0 || entries_.empty()) {
+            return 0;
+        }
+
+        const auto point = DirectX::XMLoadFloat3(&position);
+        const int32_t origin[3] = { toCell(position.x), toCell(position.y), toCell(position.z) };
+
+        size_t count = 0;
+        auto visit = [&](int32_t x, int32_t y, int32_t z) {
+            const Cell* cell = findCell(x, y, z);
+            if (!cell || (cell->layers & filter.layers) == 0) {
+                return;
+            }
+            for (uint32_t i = cell->begin; i < cell->begin + cell->count; ++i) {
+                const Entry& entry = entries_[refs_[i].second];
+                // E̒SZł̂ݔ肷
+                if (entry.cellCenter[0] != x || entry.cellCenter[1] != y || entry.cellCenter[2] != z) {
+                    continue;
+                }
+                if ((entry.layer & filter.layers) == 0 || !matches(entry, filter)) {
+                    continue;
+                }
+
+                const float distance = DirectX::XMVectorGetX(DirectX::XMVector3Length(DirectX::XMVectorSubtract(point, DirectX::XMLoadFloat4(&entry.sphere))));
+                if (count == k) {
+                    if (hits[count - 1].distance <= distance) {
+                        continue;
+                    }
+                    --count;
+                }
+                size_t insert = count;
+                for (; insert > 0 && hits[insert - 1].distance > distance; --insert) {
+                    hits[insert] = hits[insert - 1];
+                }
+                hits[insert] = { entry.handle, distance };
+                ++count;
+            }
+        };
+
+        // ̒So^͈͂܂ł̋(Z)Tn߂
+        int32_t ring = 0;
+        int32_t lastRing = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            ring = (std::max)({ ring, bounds_.min[axis] - origin[axis], origin[axis] - bounds_.max[axis] });
+            lastRing = (std::max)({ lastRing, origin[axis] - bounds_.min[axis], bounds_.max[axis] - origin[axis] });
+        }
+
+        // S̃ZOֈLĒT
+        for (; ring <= lastRing; ++ring) {
+            const int32_t xMin = (std::max)(origin[0] - ring, bounds_.min[0]);
+            const int32_t xMax = (std::min)(origin[0] + ring, bounds_.max[0]);
+            const int32_t yMin = (std::max)(origin[1] - ring, bounds_.min[1]);
+            const int32_t yMax = (std::min)(origin[1] + ring, bounds_.max[1]);
+            const int32_t zMin = (std::max)(origin[2] - ring, bounds_.min[2]);
+            const int32_t zMax = (std::min)(origin[2] + ring, bounds_.max[2]);
+            for (int32_t x = xMin; x <= xMax; ++x) {
+                for (int32_t y = yMin; y <= yMax; ++y) {
+                    if (std::abs(x - origin[0]) == ring || std::abs(y - origin[1]) == ring) {
+                        for (int32_t z = zMin; z <= zMax; ++z) {
+                            visit(x, y, z);
+                        }
+                        continue;
+                    }
+                    // ̓ z ̗[̂
+                    if (origin[2] - ring >= bounds_.min[2]) {
+                        visit(x, y, origin[2] - ring);
+                    }
+                    if (ring > 0 && origin[2] + ring <= bounds_.max[2]) {
+                        visit(x, y, origin[2] + ring);
+                    }
+                }
+            }
+
+            // ̎̃IuWFNg͂̎̊Oɂ̂ŁAʂ܂ĂĂ߂ΏI
+            if (count == k && hits[count - 1].distance <= static_cast<float>(ring) * cellSize_) {
+                break;
+            }
+        }
+
+        return count;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	WZWvZ
+     * @param	value	W
+     * @return	ZW
+     */
+    int32_t SpatialGrid::toCell(float value) const noexcept {
+        constexpr float limit = static_cast<float>(cellCoordBias_ - 1);
+        return static_cast<int32_t>(std::clamp(std::floor(value / cellSize_), -limit, limit));
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	AABB dȂZW͈̔͂vZ
+     * @param	center	AABB ̒S
+     * @param	extents	AABB ̊e̔̒
+     * @param	range	ZW͈̔͂̏o͐
+     */
+    void SpatialGrid::toCellRange(DirectX::FXMVECTOR center, DirectX::FXMVECTOR extents, CellRange& range) const noexcept {
+        DirectX::XMFLOAT3 lower{};
+        DirectX::XMFLOAT3 upper{};
+        DirectX::XMStoreFloat3(&lower, DirectX::XMVectorSubtract(center, extents));
+        DirectX::XMStoreFloat3(&upper, DirectX::XMVectorAdd(center, extents));
+
+        range.min[0] = toCell(lower.x);
+        range.min[1] = toCell(lower.y);
+        range.min[2] = toCell(lower.z);
+        range.max[0] = toCell(upper.x);
+        range.max[1] = toCell(upper.y);
+        range.max[2] = toCell(upper.z);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ZWZ̃L[쐬
+     */
+    UINT64 SpatialGrid::cellKey(int32_t x, int32_t y, int32_t z) noexcept {
+        return (static_cast<UINT64>(x + cellCoordBias_) & cellCoordMask_) << (cellCoordBits_ * 2) |
+               (static_cast<UINT64>(y + cellCoordBias_) & cellCoordMask_) << cellCoordBits_ |
+               (static_cast<UINT64>(z + cellCoordBias_) & cellCoordMask_);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Z̃L[ZWo
+     */
+    int32_t SpatialGrid::cellCoord(UINT64 key, int axis) noexcept {
+        const auto shift = cellCoordBits_ * (2 - axis);
+        return static_cast<int32_t>((key >> shift) & cellCoordMask_) - cellCoordBias_;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Z擾
+     * @return	Z(݂Ȃꍇ nullptr)
+     */
+    const SpatialGrid::Cell* SpatialGrid::findCell(int32_t x, int32_t y, int32_t z) const noexcept {
+        auto it = cells_.find(cellKey(x, y, z));
+        if (it == cells_.end()) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	i荞ݏɈv邩
+     */
+    bool SpatialGrid::matches(const Entry& entry, const QueryFilter& filter) noexcept {
+        if (entry.handle == filter.ignore) {
+            return false;
+        }
+        return filter.typeId == 0 || entry.typeId == filter.typeId;
+    }
+}  // namespace game
@@ -0,0 +1,303 @@
+// ԕObhNX
+
+#pragma once
+
+#include "game_object.h"
+#include <DirectXMath.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace game {
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Ԍ̍i荞ݏ
+     */
+    struct QueryFilter {
+        CollisionMask layers = collisionMaskAll;  /// ΏۂƂՓ˃C[̃}XN
+        UINT64        typeId{};                   /// ΏۂƂIuWFNg^CvID(0 ̏ꍇ͑S)
+        UINT64        ignore{};                   /// OIuWFNgnh
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	t̋Ԍ
+     */
+    struct QueryHit {
+        UINT64 handle{};    /// IuWFNgnh
+        float  distance{};  /// ̊_̋
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ԕObhNX
+     * E{[dȂZSĂɃIuWFNgo^nbVObh
+     * Փ˔ƋԌŋL
+     */
+    class SpatialGrid final {
+    public:
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief    RXgN^
+         */
+        SpatialGrid() = default;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief    fXgN^
+         */
+        ~SpatialGrid() = default;
+
+    public:
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Z̑傫ݒ肷
+         * @param	cellSize	Z̈ӂ̒
+         */
+        void setCellSize(float cellSize) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Obh\z
+         * @param	objects	o^IuWFNg([hԂ̋E{[XVς݂ł邱)
+         */
+        void build(const std::vector<GameObject*>& objects) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ObhNA
+         */
+        void clear() noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	AABB ƏdȂ\̂IuWFNg񋓂
+         * IuWFNg͈x񋓂BXbhZ[t
+         * @param	center	AABB ̒S
+         * @param	extents	AABB ̊e̔̒
+         * @param	layers	ΏۂƂՓ˃C[̃}XN
+         * @param	func	IuWFNgɌĂяo֐
+         */
+        template <class Func>
+        void forEachCandidate(DirectX::FXMVECTOR center, DirectX::FXMVECTOR extents, CollisionMask layers, Func&& func) const noexcept {
+            CellRange range{};
+            toCellRange(center, extents, range);
+            visitCells(range, layers, [&](const Entry& entry) {
+                func(*entry.object);
+                return true;
+            });
+        }
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	CƌIuWFNg߂Ɏ擾
+         * ͋EŔ肷
+         * @param	origin		C̎n_
+         * @param	direction	C̕
+         * @param	maxDistance	C̒
+         * @param	filter		i荞ݏ
+         * @param	hits		ʂ̏ݐ
+         * @param	capacity	ݐ̗vf
+         * @return	񂾌ʂ̐
+         */
+        [[nodiscard]] size_t raycast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction, float maxDistance,
+            const QueryFilter& filter, QueryHit* hits, size_t capacity) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ƏdȂIuWFNg擾
+         * @param	center		̒S
+         * @param	radius		̔a
+         * @param	filter		i荞ݏ
+         * @param	handles		ʂ̏ݐ
+         * @param	capacity	ݐ̗vf
+         * @return	񂾌ʂ̐
+         */
+        [[nodiscard]] size_t overlapSphere(const DirectX::XMFLOAT3& center, float radius,
+            const QueryFilter& filter, UINT64* handles, size_t capacity) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	AABB ƏdȂIuWFNg擾
+         * @param	center		AABB ̒S
+         * @param	extents		AABB ̊e̔̒
+         * @param	filter		i荞ݏ
+         * @param	handles		ʂ̏ݐ
+         * @param	capacity	ݐ̗vf
+         * @return	񂾌ʂ̐
+         */
+        [[nodiscard]] size_t overlapBox(const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents,
+            const QueryFilter& filter, UINT64* handles, size_t capacity) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	߂ k ̃IuWFNg擾
+         * ͋E̒Ső
+         * @param	position	̒S
+         * @param	filter		i荞ݏ
+         * @param	hits		ʂ̏ݐ
+         * @param	k			擾鐔(ݐ̗vf)
+         * @return	񂾌ʂ̐
+         */
+        [[nodiscard]] size_t nearest(const DirectX::XMFLOAT3& position,
+            const QueryFilter& filter, QueryHit* hits, size_t k) const noexcept;
+
+    private:
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	o^IuWFNg
+         */
+        struct Entry {
+            GameObject*       object{};         /// IuWFNg
+            UINT64            handle{};         /// IuWFNgnh
+            UINT64            typeId{};         /// IuWFNg^CvID
+            CollisionMask     layer{};          /// Փ˃C[̃}XNrbg
+            DirectX::XMFLOAT4 sphere{};         /// E(xyz: S, w: a)
+            DirectX::XMFLOAT3 boxCenter{};      /// AABB ̒S
+            DirectX::XMFLOAT3 boxExtents{};     /// AABB ̊e̔̒
+            int32_t           cellMin[3]{};     /// o^ŏZW
+            int32_t           cellCenter[3]{};  /// E̒S̃ZW
+        };
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Z
+         */
+        struct Cell {
+            uint32_t      begin{};   /// QƃXg̊Jnʒu
+            uint32_t      count{};   /// QƐ
+            CollisionMask layers{};  /// Zɑ݂Փ˃C[̃}XN
+        };
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ZW͈̔
+         */
+        struct CellRange {
+            int32_t min[3]{};  /// ŏZW
+            int32_t max[3]{};  /// őZW
+        };
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	WZWvZ
+         * @param	value	W
+         * @return	ZW
+         */
+        [[nodiscard]] int32_t toCell(float value) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	AABB dȂZW͈̔͂vZ
+         * @param	center	AABB ̒S
+         * @param	extents	AABB ̊e̔̒
+         * @param	range	ZW͈̔͂̏o͐
+         */
+        void toCellRange(DirectX::FXMVECTOR center, DirectX::FXMVECTOR extents, CellRange& range) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	ZWZ̃L[쐬
+         */
+        [[nodiscard]] static UINT64 cellKey(int32_t x, int32_t y, int32_t z) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Z擾
+         * @return	Z(݂Ȃꍇ nullptr)
+         */
+        [[nodiscard]] const Cell* findCell(int32_t x, int32_t y, int32_t z) const noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	i荞ݏɈv邩
+         */
+        [[nodiscard]] static bool matches(const Entry& entry, const QueryFilter& filter) noexcept;
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	͈͓̃Zɓo^ꂽIuWFNgdȂ񋓂
+         * @param	range	ZW͈̔
+         * @param	layers	ΏۂƂՓ˃C[̃}XN
+         * @param	func	IuWFNgɌĂяo֐(false ԂƗ񋓂I)
+         */
+        template <class Func>
+        void visitCells(const CellRange& range, CollisionMask layers, Func&& func) const noexcept {
+            // ͈͓̃Zo^Z葽ꍇ͓o^Z𑖍
+            const UINT64 rangeCount =
+                UINT64(range.max[0] - range.min[0] + 1) *
+                UINT64(range.max[1] - range.min[1] + 1) *
+                UINT64(range.max[2] - range.min[2] + 1);
+            if (rangeCount > cells_.size()) {
+                for (const auto& [key, cell] : cells_) {
+                    const int32_t c[3] = { cellCoord(key, 0), cellCoord(key, 1), cellCoord(key, 2) };
+                    if (c[0] < range.min[0] || c[0] > range.max[0] ||
+                        c[1] < range.min[1] || c[1] > range.max[1] ||
+                        c[2] < range.min[2] || c[2] > range.max[2]) {
+                        continue;
+                    }
+                    if (!visitCell(cell, c, range, layers, func)) {
+                        return;
+                    }
+                }
+                return;
+            }
+
+            for (int32_t x = range.min[0]; x <= range.max[0]; ++x) {
+                for (int32_t y = range.min[1]; y <= range.max[1]; ++y) {
+                    for (int32_t z = range.min[2]; z <= range.max[2]; ++z) {
+                        if (const Cell* cell = findCell(x, y, z)) {
+                            const int32_t c[3] = { x, y, z };
+                            if (!visitCell(*cell, c, range, layers, func)) {
+                                return;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Zɓo^ꂽIuWFNg񋓂
+         * Zɓo^ꂽIuWFNǵA͈͂Ɠo^͈͂dȂŏ̃Zł̂ݗ񋓂
+         * @return	񋓂𑱂ꍇ true
+         */
+        template <class Func>
+        [[nodiscard]] bool visitCell(const Cell& cell, const int32_t (&c)[3], const CellRange& range, CollisionMask layers, Func&& func) const noexcept {
+            // ΏۃC[݂ȂZ͊ۂƔ΂
+            if ((cell.layers & layers) == 0) {
+                return true;
+            }
+            for (uint32_t i = cell.begin; i < cell.begin + cell.count; ++i) {
+                const Entry& entry = entries_[refs_[i].second];
+                if ((entry.layer & layers) == 0) {
+                    continue;
+                }
+                if (c[0] != (std::max)(range.min[0], entry.cellMin[0]) ||
+                    c[1] != (std::max)(range.min[1], entry.cellMin[1]) ||
+                    c[2] != (std::max)(range.min[2], entry.cellMin[2])) {
+                    continue;
+                }
+                if (!func(entry)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        //---------------------------------------------------------------------------------
+        /**
+         * @brief	Z̃L[ZWo
+         */
+        [[nodiscard]] static int32_t cellCoord(UINT64 key, int axis) noexcept;
+
+    private:
+        float                                  cellSize_ = 4.0f;  /// Z̈ӂ̒
+        std::vector<Entry>                     entries_{};        /// o^IuWFNg
+        std::vector<std::pair<UINT64, UINT32>> refs_{};           /// Z̃L[Ɠo^IuWFNgԍ̑g(L[)
+        std::unordered_map<UINT64, Cell>       cells_{};          /// Z
+        CellRange                              bounds_{};         /// o^IuWFNgŜ̃ZW͈̔
+    };
+}  // namespace game
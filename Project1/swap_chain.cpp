@@ -17,7 +17,7 @@
     const auto [w, h] = Window::instance().size();
 
     swapChainDesc_ = {};
-    swapChainDesc_.BufferCount = 2;                                // obNobt@̐i_uobt@j
+    swapChainDesc_.BufferCount = bufferCount;                      // obNobt@̐i_uobt@j
     swapChainDesc_.Width = w;                                // obNobt@̉
     swapChainDesc_.Height = h;                                // obNobt@̏c
     swapChainDesc_.Format = DXGI_FORMAT_R8G8B8A8_UNORM;       // obNobt@̃tH[}bg
@@ -9,6 +9,10 @@
  * @brief	Xbv`FCNX
  */
 class SwapChain final {
+public:
+    /// obNobt@̐iɏɂȂ蓾t[j
+    static constexpr UINT bufferCount = 2;
+
 public:
     //---------------------------------------------------------------------------------
     /**
@@ -23,19 +23,11 @@ public:
      */
     ~TrianglePolygon() = default;
 
-private:
-    //---------------------------------------------------------------------------------
-    /**
-     * @brief	_obt@̐
-     * @return	 true
-     */
-    [[nodiscard]] virtual bool createVertexBuffer() noexcept override;
-
+public:
     //---------------------------------------------------------------------------------
     /**
-     * @brief	CfbNXobt@̐
-     * @return	 true
+     * @brief	_f[^ƃCfbNXf[^擾
+     * @return	`̃f[^
      */
-    [[nodiscard]] virtual bool createIndexBuffer() noexcept override;
-
+    [[nodiscard]] ShapeGeometry geometry() const noexcept override;
 };
\ No newline at end of file
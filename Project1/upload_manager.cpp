@@ -0,0 +1,199 @@
+// Abv[hǗNX
+
+#include "upload_manager.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Rs[L[ƃXe[WÖ̍쐬
+ * @param	stagingSize	Xe[WÖ̃TCY
+ * @return	̐
+ */
+[[nodiscard]] bool UploadManager::create(UINT64 stagingSize) noexcept {
+    // `ƕsē]ł悤ɁA]p̃Rs[L[g
+    if (!queue_.create(D3D12_COMMAND_LIST_TYPE_COPY)) {
+        assert(false && "Rs[L[̍쐬Ɏs");
+        return false;
+    }
+
+    for (auto& allocator : allocators_) {
+        if (!allocator.create(D3D12_COMMAND_LIST_TYPE_COPY)) {
+            assert(false && "Rs[pR}hAP[^̍쐬Ɏs");
+            return false;
+        }
+    }
+
+    if (!commandList_.create(allocators_[0])) {
+        assert(false && "Rs[pR}hXg̍쐬Ɏs");
+        return false;
+    }
+
+    if (!fence_.create()) {
+        assert(false && "Rs[ptFX̍쐬Ɏs");
+        return false;
+    }
+
+    // Xe[WÖ̓Rs[L[̃tFXlŉ
+    if (!staging_.create(stagingSize)) {
+        assert(false && "Xe[WÖ̍쐬Ɏs");
+        return false;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	obt@ւ̓]L^
+ * Xe[WÖɃf[^݁A]R}h݂̃ob`֒ǉ
+ * Xe[WÖ悪󂭂܂őҋ@AXe[WÖ̔傫f[^͕ē]
+ * @param	destination			]̃obt@
+ * @param	destinationOffset	]̃ItZbg
+ * @param	data				f[^
+ * @param	size				f[^̃TCY
+ * @return	]̃`Pbg(TCY 0 ̏ꍇ nullopt)
+ */
+[[nodiscard]] std::optional<UploadManager::Ticket> UploadManager::uploadBuffer(ID3D12Resource* destination, UINT64 destinationOffset, const void* data, UINT64 size) noexcept {
+    assert(destination && "]̃obt@܂");
+    if (size == 0) {
+        return std::nullopt;
+    }
+
+    // O̐܂ԂʒuɊւ炸ÃXe[WÖɂ͔̃TCY܂ŕK܂
+    const UINT64 chunkSize = staging_.size() / 2;
+    const auto*  source = static_cast<const std::byte*>(data);
+    for (UINT64 offset = 0; offset < size; offset += chunkSize) {
+        const UINT64 copySize = (std::min)(chunkSize, size - offset);
+        const auto   allocation = allocateStaging(copySize);
+        if (!allocation) {
+            assert(false && "Xe[WÖmۂł܂");
+            return std::nullopt;
+        }
+        std::memcpy(allocation->cpu, source + offset, copySize);
+
+        if (!recording_) {
+            begin();
+        }
+        commandList_.get()->CopyBufferRegion(destination, destinationOffset + offset, allocation->resource, allocation->offset, copySize);
+    }
+
+    // ]̃ob`ɂ܂ĂAtFXl͏Ɋ̂ōŌ̃ob`̃tFXl`PbgɂȂ
+    return nextFenceValue_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	L^]Rs[L[֑M
+ * t[ĂяoBL^ȂΉȂ
+ */
+void UploadManager::submit() noexcept {
+    if (!recording_) {
+        return;
+    }
+
+    commandList_.get()->Close();
+    ID3D12CommandList* ppCommandLists[] = { commandList_.get() };
+    queue_.get()->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
+    queue_.get()->Signal(fence_.get(), nextFenceValue_);
+
+    // ̃ob`̃Xe[WÖƃR}hAP[^̓tFXl̊܂Ŏgp
+    staging_.endFrame(nextFenceValue_);
+    allocatorFenceValues_[current_] = nextFenceValue_;
+
+    current_ = (current_ + 1) % batchCount_;
+    nextFenceValue_++;
+    recording_ = false;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	]mF
+ * @param	ticket	]̃`Pbg
+ * @return	Ă true
+ */
+[[nodiscard]] bool UploadManager::isComplete(Ticket ticket) const noexcept {
+    return fence_.completedValue() >= ticket;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	]̊ CPU őҋ@
+ * M̏ꍇ͑MĂҋ@
+ * @param	ticket	]̃`Pbg
+ */
+void UploadManager::wait(Ticket ticket) noexcept {
+    if (ticket >= nextFenceValue_) {
+        submit();
+    }
+    fence_.wait(ticket);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	]̊ʂ̃R}hL[őҋ@
+ * CPU ͑ҋ@ȂBȍ~ɑMꂽR}hXg͓]̊Ɏs
+ * @param	queue	ҋ@R}hL[
+ * @param	ticket	]̃`Pbg
+ */
+void UploadManager::waitOnQueue(const CommandQueue& queue, Ticket ticket) noexcept {
+    if (ticket >= nextFenceValue_) {
+        submit();
+    }
+    queue.get()->Wait(fence_.get(), ticket);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	SĂ̓]𑗐MĊҋ@
+ */
+void UploadManager::flush() noexcept {
+    submit();
+    if (nextFenceValue_ > 1) {
+        fence_.wait(nextFenceValue_ - 1);
+    }
+    staging_.retire(fence_.completedValue());
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	]R}h̋L^Jn
+ * gpR}hAP[^̑O̓]ĂȂΑҋ@
+ */
+void UploadManager::begin() noexcept {
+    if (allocatorFenceValues_[current_] != 0) {
+        fence_.wait(allocatorFenceValues_[current_]);
+    }
+    allocators_[current_].reset();
+    commandList_.reset(allocators_[current_]);
+    recording_ = true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Xe[WÖmۂ
+ * Ȃꍇ͋L^̃ob`𑗐MAÂob`珇Ɋ҂ė̈󂯂
+ * @param	size	mۂTCY(Xe[WÖ̔ȉ)
+ * @return	mۂ̈
+ */
+[[nodiscard]] std::optional<UploadRing::Allocation> UploadManager::allocateStaging(UINT64 size) noexcept {
+    assert(size <= staging_.size() / 2 && "Xe[WÖ̔傫̈͊mۂł܂");
+
+    // ]ob`̃Xe[WÖĂmۂ
+    staging_.retire(fence_.completedValue());
+    auto allocation = staging_.allocate(size, 4);
+    if (allocation) {
+        return allocation;
+    }
+
+    // L^̃ob`MȂƁÄ̗͉Ȃ
+    submit();
+    while (!allocation && fence_.completedValue() + 1 < nextFenceValue_) {
+        fence_.wait(fence_.completedValue() + 1);
+        staging_.retire(fence_.completedValue());
+        allocation = staging_.allocate(size, 4);
+    }
+    return allocation;
+}
@@ -0,0 +1,145 @@
+// Abv[hǗNX
+
+#pragma once
+
+#include "command_queue.h"
+#include "command_allocator.h"
+#include "command_list.h"
+#include "fence.h"
+#include "upload_ring.h"
+#include <optional>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Abv[hǗNX
+ * ]p̃Rs[L[ŁAAbv[hq[ṽXe[WÖ悩ftHgq[ṽ\[Xփf[^]
+ * ]R}h͂܂Ƃ߂ċL^ submit() őMA̓`Pbg(Rs[L[̃tFXl)ŊmF
+ * ]̃\[X COMMON Xe[gō쐬Ă(Rs[L[ł̓oA𒣂Ȃ)
+ * ȈՃVOgp^[ō쐬
+ */
+class UploadManager final {
+public:
+    using Ticket = UINT64;  /// ]̊mFɎg`Pbg
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CX^X̎擾
+     * @return	CX^X̎Q
+     */
+    static UploadManager& instance() noexcept {
+        static UploadManager instance;
+        return instance;
+    }
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Rs[L[ƃXe[WÖ̍쐬
+     * @param	stagingSize	Xe[WÖ̃TCY
+     * @return	̐
+     */
+    [[nodiscard]] bool create(UINT64 stagingSize) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	obt@ւ̓]L^
+     * Xe[WÖɃf[^݁A]R}h݂̃ob`֒ǉ
+     * Xe[WÖ悪󂭂܂őҋ@AXe[WÖ̔傫f[^͕ē]
+     * @param	destination			]̃obt@
+     * @param	destinationOffset	]̃ItZbg
+     * @param	data				f[^
+     * @param	size				f[^̃TCY
+     * @return	]̃`Pbg(TCY 0 ̏ꍇ nullopt)
+     */
+    [[nodiscard]] std::optional<Ticket> uploadBuffer(ID3D12Resource* destination, UINT64 destinationOffset, const void* data, UINT64 size) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	L^]Rs[L[֑M
+     * t[ĂяoBL^ȂΉȂ
+     */
+    void submit() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	]mF
+     * @param	ticket	]̃`Pbg
+     * @return	Ă true
+     */
+    [[nodiscard]] bool isComplete(Ticket ticket) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	]̊ CPU őҋ@
+     * M̏ꍇ͑MĂҋ@
+     * @param	ticket	]̃`Pbg
+     */
+    void wait(Ticket ticket) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	]̊ʂ̃R}hL[őҋ@
+     * CPU ͑ҋ@ȂBȍ~ɑMꂽR}hXg͓]̊Ɏs
+     * @param	queue	ҋ@R}hL[
+     * @param	ticket	]̃`Pbg
+     */
+    void waitOnQueue(const CommandQueue& queue, Ticket ticket) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	SĂ̓]𑗐MĊҋ@
+     */
+    void flush() noexcept;
+
+private:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    UploadManager() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~UploadManager() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Rs[ƃ[ű֎~
+     */
+    UploadManager(const UploadManager&) = delete;
+    UploadManager& operator=(const UploadManager&) = delete;
+    UploadManager(UploadManager&&) = delete;
+    UploadManager& operator=(UploadManager&&) = delete;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	]R}h̋L^Jn
+     * gpR}hAP[^̑O̓]ĂȂΑҋ@
+     */
+    void begin() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Xe[WÖmۂ
+     * Ȃꍇ͋L^̃ob`𑗐MAÂob`珇Ɋ҂ė̈󂯂
+     * @param	size	mۂTCY(Xe[WÖ̔ȉ)
+     * @return	mۂ̈
+     */
+    [[nodiscard]] std::optional<UploadRing::Allocation> allocateStaging(UINT64 size) noexcept;
+
+private:
+    static constexpr UINT batchCount_ = 2;  /// ɏłob`
+
+    CommandQueue     queue_{};                              /// Rs[L[
+    CommandAllocator allocators_[batchCount_]{};            /// ob`̃R}hAP[^
+    UINT64           allocatorFenceValues_[batchCount_]{};  /// R}hAP[^ŌɎgob`̃tFXl
+    CommandList      commandList_{};                        /// ]R}hL^R}hXg
+    Fence            fence_{};                              /// ]̃tFX
+    UploadRing       staging_{};                            /// Xe[WÖ
+    UINT64           nextFenceValue_ = 1;                   /// L^̃ob`̃tFXl
+    UINT             current_{};                            /// L^̃ob`̃R}hAP[^ԍ
+    bool             recording_{};                          /// ]R}hL^
+};
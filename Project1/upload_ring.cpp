@@ -0,0 +1,149 @@
+// Abv[hOobt@NX
+
+#include "upload_ring.h"
+#include <cassert>
+
+namespace {
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ACgɐ؂グ
+     * @param	value		l
+     * @param	alignment	ACg(2 ̗ݏ)
+     * @return	؂グl
+     */
+    [[nodiscard]] constexpr UINT64 alignUp(UINT64 value, UINT64 alignment) noexcept {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief    fXgN^
+ */
+UploadRing::~UploadRing() {
+    if (buffer_) {
+        buffer_->Unmap(0, nullptr);
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Oobt@̍쐬
+ * @param	size	obt@̃TCY(256 oCgPʂɐ؂グ)
+ * @return	̐
+ */
+[[nodiscard]] bool UploadRing::create(UINT64 size) noexcept {
+    size_ = alignUp(size, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+
+    // CPU 珑ނ̂ŃAbv[hq[vɍ쐬
+    D3D12_HEAP_PROPERTIES heapProperty{};
+    heapProperty.Type = D3D12_HEAP_TYPE_UPLOAD;
+    heapProperty.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    heapProperty.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    heapProperty.CreationNodeMask = 1;
+    heapProperty.VisibleNodeMask = 1;
+
+    D3D12_RESOURCE_DESC resourceDesc{};
+    resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    resourceDesc.Alignment = 0;
+    resourceDesc.Width = size_;
+    resourceDesc.Height = 1;
+    resourceDesc.DepthOrArraySize = 1;
+    resourceDesc.MipLevels = 1;
+    resourceDesc.Format = DXGI_FORMAT_UNKNOWN;
+    resourceDesc.SampleDesc.Count = 1;
+    resourceDesc.SampleDesc.Quality = 0;
+    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+    auto res = Device::instance().get()->CreateCommittedResource(
+        &heapProperty,
+        D3D12_HEAP_FLAG_NONE,
+        &resourceDesc,
+        D3D12_RESOURCE_STATE_GENERIC_READ,
+        nullptr,
+        IID_PPV_ARGS(&buffer_));
+    if (FAILED(res)) {
+        assert(false && "Abv[hOobt@̍쐬Ɏs");
+        return false;
+    }
+
+    // t[ނ̂Ń}bv܂܂ɂ
+    res = buffer_->Map(0, nullptr, reinterpret_cast<void**>(&mapped_));
+    if (FAILED(res)) {
+        assert(false && "Abv[hOobt@̃}bvɎs");
+        return false;
+    }
+    gpuBase_ = buffer_->GetGPUVirtualAddress();
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	̈mۂ
+ * Ɏ܂Ȃꍇ͐擪ɐ܂Ԃ
+ * @param	size		mۂTCY
+ * @param	alignment	ACg(2 ̗ݏ)
+ * @return	mۂ̈(󂫂Ȃꍇ nullopt)
+ */
+[[nodiscard]] std::optional<UploadRing::Allocation> UploadRing::allocate(UINT64 size, UINT64 alignment) noexcept {
+    assert(mapped_ && "Abv[hOobt@쐬ł");
+    assert((alignment & (alignment - 1)) == 0 && "ACg 2 ̗ݏł͂܂");
+    if (size == 0 || size > size_) {
+        return std::nullopt;
+    }
+
+    UINT64 begin = alignUp(head_, alignment);
+    // Ɏ܂Ȃꍇ͎̎̐擪mۂ
+    if (begin % size_ + size > size_) {
+        begin = (begin / size_ + 1) * size_;
+    }
+    // GPU gp͈̔͂ɒǂĂ܂ꍇ͊mۂłȂ
+    if (begin + size - tail_ > size_) {
+        return std::nullopt;
+    }
+    head_ = begin + size;
+
+    const UINT64 offset = begin % size_;
+    return Allocation{ mapped_ + offset, gpuBase_ + offset, size, buffer_.Get(), offset };
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	GPU ̏t[̗̈
+ * @param	completedFenceValue	tFXl
+ */
+void UploadRing::retire(UINT64 completedFenceValue) noexcept {
+    while (!frames_.empty() && frames_.front().fenceValue <= completedFenceValue) {
+        tail_ = frames_.front().end;
+        frames_.pop_front();
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	t[Ɋmۂ̈tFXlƊ֘At
+ * @param	fenceValue	t[̃R}hXg̊ɃVOitFXl
+ */
+void UploadRing::endFrame(UINT64 fenceValue) noexcept {
+    frames_.push_back({ fenceValue, head_ });
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	gp̃TCY擾
+ * @return	GPU ̏ĂȂ̈ƍt[Ɋmۂ̈̍v
+ */
+[[nodiscard]] UINT64 UploadRing::usedSize() const noexcept {
+    return head_ - tail_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	obt@̃TCY擾
+ * @return	obt@̃TCY
+ */
+[[nodiscard]] UINT64 UploadRing::size() const noexcept {
+    return size_;
+}
@@ -0,0 +1,129 @@
+// Abv[hOobt@NX
+
+#pragma once
+
+#include "device.h"
+#include <cstddef>
+#include <deque>
+#include <optional>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Abv[hOobt@NX
+ * Ƀ}bv܂܂1̃Abv[hobt@疈t[̃f[^`Ɋmۂ
+ * t[̊m۔͈͂̓tFXlŊǗAGPU gp͈̔͂͏㏑Ȃ
+ * t[̃f[^p͊ȈՃVOgp^[ŋLAʂ̃L[Ŏgꍇ͌ʂɍ쐬
+ */
+class UploadRing final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	mۂ̈
+     */
+    struct Allocation {
+        std::byte*                cpu{};       /// ݐ̃AhX
+        D3D12_GPU_VIRTUAL_ADDRESS gpu{};       /// GPU zAhX
+        UINT64                    size{};      /// mۂTCY
+        ID3D12Resource*           resource{};  /// mی̃obt@(Rs[Ɏw肷ꍇɎg)
+        UINT64                    offset{};    /// mی̃obt@̃ItZbg
+    };
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    UploadRing() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    fXgN^
+     */
+    ~UploadRing();
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CX^X̎擾
+     * t[̃f[^pɋL郊OԂ
+     * @return	CX^X̎Q
+     */
+    static UploadRing& instance() noexcept {
+        static UploadRing instance;
+        return instance;
+    }
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Oobt@̍쐬
+     * @param	size	obt@̃TCY(256 oCgPʂɐ؂グ)
+     * @return	̐
+     */
+    [[nodiscard]] bool create(UINT64 size) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	̈mۂ
+     * Ɏ܂Ȃꍇ͐擪ɐ܂Ԃ
+     * @param	size		mۂTCY
+     * @param	alignment	ACg(2 ̗ݏ)
+     * @return	mۂ̈(󂫂Ȃꍇ nullopt)
+     */
+    [[nodiscard]] std::optional<Allocation> allocate(UINT64 size, UINT64 alignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	GPU ̏t[̗̈
+     * @param	completedFenceValue	tFXl
+     */
+    void retire(UINT64 completedFenceValue) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	t[Ɋmۂ̈tFXlƊ֘At
+     * @param	fenceValue	t[̃R}hXg̊ɃVOitFXl
+     */
+    void endFrame(UINT64 fenceValue) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	gp̃TCY擾
+     * @return	GPU ̏ĂȂ̈ƍt[Ɋmۂ̈̍v
+     */
+    [[nodiscard]] UINT64 usedSize() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	obt@̃TCY擾
+     * @return	obt@̃TCY
+     */
+    [[nodiscard]] UINT64 size() const noexcept;
+
+private:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Rs[ƃ[ű֎~
+     */
+    UploadRing(const UploadRing&) = delete;
+    UploadRing& operator=(const UploadRing&) = delete;
+    UploadRing(UploadRing&&) = delete;
+    UploadRing& operator=(UploadRing&&) = delete;
+
+private:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	t[̊m۔͈
+     */
+    struct Frame {
+        UINT64 fenceValue{};  /// ɃVOitFXl
+        UINT64 end{};         /// m۔͈͂̏I[ʒu
+    };
+
+    Microsoft::WRL::ComPtr<ID3D12Resource> buffer_{};   /// Abv[hobt@
+    std::byte*                             mapped_{};   /// }bvAhX
+    D3D12_GPU_VIRTUAL_ADDRESS              gpuBase_{};  /// obt@ GPU zAhX
+    UINT64                                 size_{};     /// obt@̃TCY
+    UINT64                                 head_{};     /// Ɋmۂʒu(ݐσoCg)
+    UINT64                                 tail_{};     /// gp̐擪ʒu(ݐσoCg)
+    std::deque<Frame>                      frames_{};   /// GPU ̏҂̃t[
+};
@@ -0,0 +1,257 @@
+// _tH[}bgNX
+
+#include "vertex_format.h"
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace {
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	-1 ` 1 ̒l snorm16 ɕϊ
+     * @param	value	l
+     * @return	ϊl
+     */
+    [[nodiscard]] int16_t toSnorm16(float value) noexcept {
+        return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	0 ` 1 ̒l unorm8 ɕϊ
+     * @param	value	l
+     * @return	ϊl
+     */
+    [[nodiscard]] uint8_t toUnorm8(float value) noexcept {
+        return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	@𔪖ʑ̃GR[h
+     * Pʋ𔪖ʑ̂ɓeēWJA2 ŕ\
+     * @param	normal	@
+     * @return	-1 ` 1  2 
+     */
+    [[nodiscard]] DirectX::XMFLOAT2 encodeOctahedral(const DirectX::XMFLOAT3& normal) noexcept {
+        const float length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+        if (length == 0.0f) {
+            return { 0.0f, 0.0f };
+        }
+        float x = normal.x / length;
+        float y = normal.y / length;
+        if (normal.z < 0.0f) {
+            // ͑ΊpŐ܂Ԃ
+            const float foldX = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            const float foldY = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = foldX;
+            y = foldY;
+        }
+        return { x, y };
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Wi[͈͂ŐK
+     * @param	position	W
+     * @param	range		W̊i[͈
+     * @return	KW
+     */
+    [[nodiscard]] DirectX::XMFLOAT3 normalizePosition(const DirectX::XMFLOAT3& position, const VertexFormat::PositionRange& range) noexcept {
+        return {
+            (position.x - range.bias.x) / range.scale.x,
+            (position.y - range.bias.y) / range.scale.y,
+            (position.z - range.bias.z) / range.scale.z,
+        };
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	loCg̖ɒǉ
+     * @param	output	ǉ
+     * @param	value	l
+     */
+    template <class T>
+    void append(std::vector<std::byte>& output, const T& value) noexcept {
+        const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+        output.insert(output.end(), bytes, bytes + sizeof(T));
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	W̊i[`擾
+ * @return	W̊i[`
+ */
+[[nodiscard]] VertexFormat::Position VertexFormat::position() const noexcept {
+    return position_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_F̊i[`擾
+ * @return	_F̊i[`
+ */
+[[nodiscard]] VertexFormat::Color VertexFormat::color() const noexcept {
+    return color_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	@̊i[`擾
+ * @return	@̊i[`
+ */
+[[nodiscard]] VertexFormat::Normal VertexFormat::normal() const noexcept {
+    return normal_;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	1_̃TCY擾
+ * @return	1_̃TCY
+ */
+[[nodiscard]] uint32_t VertexFormat::stride() const noexcept {
+    uint32_t stride = position_ == Position::Float3 ? 12 : 8;
+
+    switch (color_) {
+        case Color::Unorm8x4: stride += 4; break;
+        case Color::Float4: stride += 16; break;
+        default: break;
+    }
+    if (normal_ == Normal::Octahedral16) {
+        stride += 4;
+    }
+
+    return stride;
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	tH[}bgʂl擾
+ * @return	ʒl
+ */
+[[nodiscard]] uint32_t VertexFormat::key() const noexcept {
+    return static_cast<uint32_t>(position_) | (static_cast<uint32_t>(color_) << 8) | (static_cast<uint32_t>(normal_) << 16);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	` AABB W̊i[͈͂߂
+ * snorm16  AABB  -1 ` 1 ɐḰ͈AȊǑ`͕ϊȂ͈̔͂Ԃ
+ * @param	boxCenter	AABB ̒S
+ * @param	boxExtents	AABB ̊e̔̒
+ * @return	W̊i[͈
+ */
+[[nodiscard]] VertexFormat::PositionRange VertexFormat::positionRange(const DirectX::XMFLOAT3& boxCenter, const DirectX::XMFLOAT3& boxExtents) const noexcept {
+    if (position_ != Position::Snorm16x4) {
+        return {};
+    }
+
+    //  0 ̎͑SĂ̒_Sɂ̂ŁAg嗦͉ł悢
+    auto scale = [](float extent) { return extent > 0.0f ? extent : 1.0f; };
+    return { { scale(boxExtents.x), scale(boxExtents.y), scale(boxExtents.z) }, boxCenter };
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_f[^̃tH[}bg֕ϊĖɒǉ
+ * @param	vertices	ϊO̒_f[^
+ * @param	count		_
+ * @param	range		W̊i[͈
+ * @param	output		ϊ̃f[^̊i[
+ */
+void VertexFormat::encode(const SourceVertex* vertices, uint32_t count, const PositionRange& range, std::vector<std::byte>& output) const noexcept {
+    using namespace DirectX::PackedVector;
+
+    output.reserve(output.size() + size_t(count) * stride());
+
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto& vertex = vertices[i];
+
+        // W(4 ̌` w  1 )
+        switch (position_) {
+            case Position::Float3:
+                append(output, vertex.position);
+                break;
+            case Position::Half4: {
+                const HALF half[] = {
+                    XMConvertFloatToHalf(vertex.position.x),
+                    XMConvertFloatToHalf(vertex.position.y),
+                    XMConvertFloatToHalf(vertex.position.z),
+                    XMConvertFloatToHalf(1.0f),
+                };
+                append(output, half);
+                break;
+            }
+            case Position::Snorm16x4: {
+                // ͈͂̒[̒_͊Ž덷 1 킸ɒ邱Ƃ
+                const auto normalized = normalizePosition(vertex.position, range);
+                assert(std::abs(normalized.x) <= 1.001f && std::abs(normalized.y) <= 1.001f && std::abs(normalized.z) <= 1.001f && "snorm16 ̍Wi[͈͊Oł");
+                const int16_t snorm[] = {
+                    toSnorm16(normalized.x),
+                    toSnorm16(normalized.y),
+                    toSnorm16(normalized.z),
+                    toSnorm16(1.0f),
+                };
+                append(output, snorm);
+                break;
+            }
+        }
+
+        // _F
+        switch (color_) {
+            case Color::Unorm8x4: {
+                const uint8_t unorm[] = {
+                    toUnorm8(vertex.color.x),
+                    toUnorm8(vertex.color.y),
+                    toUnorm8(vertex.color.z),
+                    toUnorm8(vertex.color.w),
+                };
+                append(output, unorm);
+                break;
+            }
+            case Color::Float4:
+                append(output, vertex.color);
+                break;
+            default:
+                break;
+        }
+
+        // @
+        if (normal_ == Normal::Octahedral16) {
+            const auto    octahedral = encodeOctahedral(vertex.normal);
+            const int16_t snorm[] = { toSnorm16(octahedral.x), toSnorm16(octahedral.y) };
+            append(output, snorm);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	W̃tH[}bgŊi[ēǂݏolɕϊ
+ * _VF[_󂯎l(i[͈͂ŐKĊۂ߂l)Ԃ̂ŁAi[͈͂̕ϊ܂ރCX^X̕ϊƑgݍ킹
+ * @param	position	ϊO̍W
+ * @param	range		W̊i[͈
+ * @return	_VF[_󂯎l
+ */
+[[nodiscard]] DirectX::XMFLOAT3 VertexFormat::quantizePosition(const DirectX::XMFLOAT3& position, const PositionRange& range) const noexcept {
+    using namespace DirectX::PackedVector;
+
+    switch (position_) {
+        case Position::Half4:
+            return {
+                XMConvertHalfToFloat(XMConvertFloatToHalf(position.x)),
+                XMConvertHalfToFloat(XMConvertFloatToHalf(position.y)),
+                XMConvertHalfToFloat(XMConvertFloatToHalf(position.z)),
+            };
+        case Position::Snorm16x4: {
+            // SNORM ̓ǂݏo -32768  -1 ƂĈ
+            auto       decode = [](float value) { return (std::max)(toSnorm16(value) / 32767.0f, -1.0f); };
+            const auto normalized = normalizePosition(position, range);
+            return { decode(normalized.x), decode(normalized.y), decode(normalized.z) };
+        }
+        default:
+            return position;
+    }
+}
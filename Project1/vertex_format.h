@@ -0,0 +1,170 @@
+// _tH[}bgNX
+
+#pragma once
+
+#include <DirectXMath.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	_tH[}bgNX
+ * WE_FE@̊evf̊i[`gݍ킹Ē_̃CAEg\
+ * ` float ̒_f[^pӂAShapeContainer ̃tH[}bg֕ϊĒ_obt@Ɋi[
+ * ̓CAEg̓tH[}bg琶̂ŁApCvCƌ`œtH[}bgg
+ * D3D12 ɈˑȂ̂ Windows ȊOłrhłB̓CAEg̐ PiplineStateObject ōs
+ */
+class VertexFormat final {
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	W̊i[`
+     */
+    enum class Position : uint8_t {
+        Float3,     /// float x3(12 oCg)
+        Half4,      /// half x4(8 oCg)
+        Snorm16x4,  /// snorm16 x4(8 oCgAW͌`󖈂͈̔͂ -1 ` 1 ɐK)
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_F̊i[`
+     */
+    enum class Color : uint8_t {
+        None,      /// _FȂ(CX^X̐F݂̂g)
+        Unorm8x4,  /// RGBA8(4 oCg)
+        Float4,    /// float x4(16 oCg)
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	@̊i[`
+     */
+    enum class Normal : uint8_t {
+        None,          /// @Ȃ
+        Octahedral16,  /// ʑ̃GR[h snorm16 x2(4 oCg)
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ϊO̒_f[^
+     * `͂̌`Œ_f[^pӂ
+     */
+    struct SourceVertex {
+        DirectX::XMFLOAT3 position{};                       /// _Wix, y, zj
+        DirectX::XMFLOAT4 color{ 1.0f, 1.0f, 1.0f, 1.0f };  /// _Fir, g, b, aj
+        DirectX::XMFLOAT3 normal{ 0.0f, 0.0f, -1.0f };      /// @
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	W̊i[͈
+     * i[lW֖߂ϊ(W = i[l * scale + bias)
+     * _VF[_͊i[l̂܂܎󂯎̂ŁA̕ϊ̓CX^X̕ϊɊ܂߂ēn
+     */
+    struct PositionRange {
+        DirectX::XMFLOAT3 scale{ 1.0f, 1.0f, 1.0f };  /// g嗦
+        DirectX::XMFLOAT3 bias{};                     /// sړ
+    };
+
+    static constexpr uint32_t maxElementCount = 3;  /// ̓CAEg̍ővf
+
+public:
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     */
+    constexpr VertexFormat() = default;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief    RXgN^
+     * @param	position	W̊i[`
+     * @param	color		_F̊i[`
+     * @param	normal		@̊i[`
+     */
+    constexpr VertexFormat(Position position, Color color, Normal normal = Normal::None) noexcept
+        : position_(position), color_(color), normal_(normal) {}
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	`p̃tH[}bg
+     * W snorm16A_FƖ@͂Ȃ(1_ 8 oCg)
+     * @return	_tH[}bg
+     */
+    [[nodiscard]] static constexpr VertexFormat compact() noexcept {
+        return VertexFormat(Position::Snorm16x4, Color::None);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	W̊i[`擾
+     * @return	W̊i[`
+     */
+    [[nodiscard]] Position position() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_F̊i[`擾
+     * @return	_F̊i[`
+     */
+    [[nodiscard]] Color color() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	@̊i[`擾
+     * @return	@̊i[`
+     */
+    [[nodiscard]] Normal normal() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	1_̃TCY擾
+     * @return	1_̃TCY
+     */
+    [[nodiscard]] uint32_t stride() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	tH[}bgʂl擾
+     * l̃tH[}bǧ`͒_obt@Lł
+     * @return	ʒl
+     */
+    [[nodiscard]] uint32_t key() const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	` AABB W̊i[͈͂߂
+     * snorm16  AABB  -1 ` 1 ɐḰ͈AȊǑ`͕ϊȂ͈̔͂Ԃ
+     * @param	boxCenter	AABB ̒S
+     * @param	boxExtents	AABB ̊e̔̒
+     * @return	W̊i[͈
+     */
+    [[nodiscard]] PositionRange positionRange(const DirectX::XMFLOAT3& boxCenter, const DirectX::XMFLOAT3& boxExtents) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_f[^̃tH[}bg֕ϊĖɒǉ
+     * @param	vertices	ϊO̒_f[^
+     * @param	count		_
+     * @param	range		W̊i[͈
+     * @param	output		ϊ̃f[^̊i[
+     */
+    void encode(const SourceVertex* vertices, uint32_t count, const PositionRange& range, std::vector<std::byte>& output) const noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	W̃tH[}bgŊi[ēǂݏolɕϊ
+     * _VF[_󂯎l(i[͈͂ŐKĊۂ߂l)Ԃ̂ŁAi[͈͂̕ϊ܂ރCX^X̕ϊƑgݍ킹
+     * @param	position	ϊO̍W
+     * @param	range		W̊i[͈
+     * @return	_VF[_󂯎l
+     */
+    [[nodiscard]] DirectX::XMFLOAT3 quantizePosition(const DirectX::XMFLOAT3& position, const PositionRange& range) const noexcept;
+
+private:
+    Position position_ = Position::Float3;  /// W̊i[`
+    Color    color_ = Color::Float4;        /// _F̊i[`
+    Normal   normal_ = Normal::None;        /// @̊i[`
+};
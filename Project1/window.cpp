@@ -112,3 +112,13 @@ namespace {
 [[nodiscard]] std::pair<int, int> Window::size() const noexcept {
     return { witdh_, height_ };
 }
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	EBhẼ^Cgݒ肷
+ * @param	title	^Cg
+ */
+void Window::setTitle(std::string_view title) const noexcept {
+    const std::string text(title);
+    SetWindowText(handle_, text.c_str());
+}
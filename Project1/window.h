@@ -54,6 +54,13 @@ public:
      */
     [[nodiscard]] std::pair<int, int> size() const noexcept;
 
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	EBhẼ^Cgݒ肷
+     * @param	title	^Cg
+     */
+    void setTitle(std::string_view title) const noexcept;
+
 private:
     //---------------------------------------------------------------------------------
     /**
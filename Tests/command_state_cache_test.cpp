@@ -0,0 +1,183 @@
+// R}hXg̃Xe[gLbṼeXg
+// LbV D3D12  API Ă΂Ȃ̂ŁA|C^͔rɂg_~[̃AhXŊmF
+
+#include "test.h"
+#include "command_state_cache.h"
+
+namespace {
+    constexpr UINT tableIndex_ = 0;     // fBXNv^e[ũ[gp[^ԍ
+    constexpr UINT srvIndex_ = 1;       // [g SRV ̃[gp[^ԍ
+    constexpr UINT constantIndex_ = 2;  // [g萔̃[gp[^ԍ
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	rɂg_~[̃IuWFNg̃AhX擾
+     * @tparam	T		IuWFNǧ^
+     * @param	index	IuWFNg̔ԍ
+     * @return	IuWFNg̃|C^
+     */
+    template <class T>
+    [[nodiscard]] T* dummy(UINT index) noexcept {
+        static char storage[8]{};
+        return reinterpret_cast<T*>(&storage[index]);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	GPU fBXNv^nh쐬
+     * @param	ptr	AhX
+     * @return	fBXNv^nh
+     */
+    [[nodiscard]] D3D12_GPU_DESCRIPTOR_HANDLE gpuHandle(UINT64 ptr) noexcept {
+        D3D12_GPU_DESCRIPTOR_HANDLE handle{};
+        handle.ptr = ptr;
+        return handle;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	[gVOl`ƃfBXNv^q[vݒ肵A3 ނ̃[gL^LbV쐬
+     * @param	cache	ݒ肷LbV
+     */
+    void setupRootArguments(CommandStateCache& cache) noexcept {
+        (void)cache.setRootSignature(dummy<ID3D12RootSignature>(0));
+        (void)cache.setDescriptorHeap(dummy<ID3D12DescriptorHeap>(0));
+        (void)cache.setDescriptorTable(tableIndex_, gpuHandle(0x1000));
+        (void)cache.setShaderResourceView(srvIndex_, 0x2000);
+        (void)cache.set32BitConstant(constantIndex_, 7, 0);
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	l̍Đݒ肪ȂAvɐ邱
+ */
+TEST_CASE(commandStateCacheEliminatesRepeatedSets) {
+    CommandStateCache cache;
+
+    D3D12_VERTEX_BUFFER_VIEW vertexBuffer{};
+    vertexBuffer.BufferLocation = 0x3000;
+    vertexBuffer.SizeInBytes = 256;
+    vertexBuffer.StrideInBytes = 16;
+
+    D3D12_VIEWPORT viewport{};
+    viewport.Width = 1280.0f;
+    viewport.Height = 720.0f;
+    viewport.MaxDepth = 1.0f;
+
+    // ͂ǂĂяoKv
+    CHECK(cache.setPipelineState(dummy<ID3D12PipelineState>(0)));
+    CHECK(cache.setVertexBuffer(0, vertexBuffer));
+    CHECK(cache.setPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST));
+    CHECK(cache.setViewport(viewport));
+
+    // l͏Ȃ
+    CHECK(!cache.setPipelineState(dummy<ID3D12PipelineState>(0)));
+    CHECK(!cache.setVertexBuffer(0, vertexBuffer));
+    CHECK(!cache.setPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST));
+    CHECK(!cache.setViewport(viewport));
+
+    // lςΌĂяo
+    vertexBuffer.SizeInBytes = 512;
+    CHECK(cache.setPipelineState(dummy<ID3D12PipelineState>(1)));
+    CHECK(cache.setVertexBuffer(0, vertexBuffer));
+
+    CHECK(cache.stats().issued == 6);
+    CHECK(cache.stats().eliminated == 4);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ʂ̃[gVOl`ݒ肷ƑSẴ[g̋L^j邱
+ */
+TEST_CASE(commandStateCacheRootSignatureClearsRootArguments) {
+    CommandStateCache cache;
+    setupRootArguments(cache);
+
+    // [gVOl`ł͋L^c
+    CHECK(!cache.setRootSignature(dummy<ID3D12RootSignature>(0)));
+    CHECK(!cache.setDescriptorTable(tableIndex_, gpuHandle(0x1000)));
+    CHECK(!cache.setShaderResourceView(srvIndex_, 0x2000));
+    CHECK(!cache.set32BitConstant(constantIndex_, 7, 0));
+
+    CHECK(cache.setRootSignature(dummy<ID3D12RootSignature>(1)));
+    CHECK(cache.setDescriptorTable(tableIndex_, gpuHandle(0x1000)));
+    CHECK(cache.setShaderResourceView(srvIndex_, 0x2000));
+    CHECK(cache.set32BitConstant(constantIndex_, 7, 0));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ʂ̃fBXNv^q[vݒ肷ƃfBXNv^e[űL^j邱
+ */
+TEST_CASE(commandStateCacheDescriptorHeapClearsOnlyTables) {
+    CommandStateCache cache;
+    setupRootArguments(cache);
+
+    CHECK(!cache.setDescriptorHeap(dummy<ID3D12DescriptorHeap>(0)));
+    CHECK(!cache.setDescriptorTable(tableIndex_, gpuHandle(0x1000)));
+
+    CHECK(cache.setDescriptorHeap(dummy<ID3D12DescriptorHeap>(1)));
+    CHECK(cache.setDescriptorTable(tableIndex_, gpuHandle(0x1000)));
+    CHECK(!cache.setShaderResourceView(srvIndex_, 0x2000));
+    CHECK(!cache.set32BitConstant(constantIndex_, 7, 0));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ItZbg 0 ȊÕ[g萔͏ɐݒ肳A擪̋L^j邱
+ */
+TEST_CASE(commandStateCacheConstantWithOffsetAlwaysIssues) {
+    CommandStateCache cache;
+    setupRootArguments(cache);
+
+    CHECK(cache.set32BitConstant(constantIndex_, 3, 1));
+    CHECK(cache.set32BitConstant(constantIndex_, 3, 1));
+
+    // 擪̒l͓łAL^jĂ̂Őݒ肷
+    CHECK(cache.set32BitConstant(constantIndex_, 7, 0));
+    CHECK(!cache.set32BitConstant(constantIndex_, 7, 0));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	invalidate() ̓Xe[g̋L^jAv͎c
+ */
+TEST_CASE(commandStateCacheInvalidateKeepsStats) {
+    CommandStateCache cache;
+    CHECK(cache.setPipelineState(dummy<ID3D12PipelineState>(0)));
+    CHECK(!cache.setPipelineState(dummy<ID3D12PipelineState>(0)));
+
+    cache.invalidate();
+    CHECK(cache.stats().issued == 1);
+    CHECK(cache.stats().eliminated == 1);
+
+    // L^͔jĂ̂ŁAlłݒ肷
+    CHECK(cache.setPipelineState(dummy<ID3D12PipelineState>(0)));
+    CHECK(cache.stats().issued == 2);
+
+    cache.resetStats();
+    CHECK(cache.stats().issued == 0);
+    CHECK(cache.stats().eliminated == 0);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ExecuteIndirect  invalidateRootArgument() ŁÃ[gĐݒ肳邱
+ * CommandList::executeIndirect() ̓R}hVOl`郋[g萔̊֐Ŕj
+ */
+TEST_CASE(commandStateCacheInvalidateRootArgumentAfterExecuteIndirect) {
+    CommandStateCache cache;
+    setupRootArguments(cache);
+
+    cache.invalidateRootArgument(constantIndex_);
+
+    CHECK(cache.set32BitConstant(constantIndex_, 7, 0));
+    CHECK(!cache.set32BitConstant(constantIndex_, 7, 0));
+    CHECK(!cache.setDescriptorTable(tableIndex_, gpuHandle(0x1000)));
+    CHECK(!cache.setShaderResourceView(srvIndex_, 0x2000));
+
+    // ͈͊O̔ԍ͖
+    cache.invalidateRootArgument(64);
+    CHECK(!cache.set32BitConstant(constantIndex_, 7, 0));
+}
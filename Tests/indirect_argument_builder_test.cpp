@@ -0,0 +1,137 @@
+// Ԑڕ`\z̃eXg
+
+#include "test.h"
+#include "indirect_argument_builder.h"
+#include <cstddef>
+#include <cstring>
+
+namespace {
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	eXgp̕`͈͂쐬
+     * @param	indexCount	CfbNX
+     * @param	startIndex	擪CfbNẌʒu
+     * @param	baseVertex	擪_̈ʒu
+     * @return	`͈
+     */
+    [[nodiscard]] ShapeDrawRange makeRange(UINT indexCount, UINT startIndex, UINT baseVertex) noexcept {
+        ShapeDrawRange range{};
+        range.indexCount = indexCount;
+        range.startIndex = startIndex;
+        range.baseVertex = baseVertex;
+        return range;
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	̕т CommandSignature([g萔  DrawIndexedInstanced)ƈv邱
+ */
+TEST_CASE(indirectArgumentsLayout) {
+    using Arguments = IndirectArgumentBuilder::Arguments;
+
+    CHECK(sizeof(Arguments) == 24);
+    CHECK(offsetof(Arguments, baseInstance) == 0);
+    CHECK(offsetof(Arguments, draw) == 4);
+    CHECK(offsetof(D3D12_DRAW_INDEXED_ARGUMENTS, IndexCountPerInstance) == 0);
+    CHECK(offsetof(D3D12_DRAW_INDEXED_ARGUMENTS, InstanceCount) == 4);
+    CHECK(offsetof(D3D12_DRAW_INDEXED_ARGUMENTS, StartIndexLocation) == 8);
+    CHECK(offsetof(D3D12_DRAW_INDEXED_ARGUMENTS, BaseVertexLocation) == 12);
+    CHECK(offsetof(D3D12_DRAW_INDEXED_ARGUMENTS, StartInstanceLocation) == 16);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	add() `͈͂ƃCX^Xɕϊ邱
+ */
+TEST_CASE(indirectArgumentsAdd) {
+    IndirectArgumentBuilder builder;
+    builder.beginBatch(0);
+    builder.add(makeRange(6, 12, 4), 5, 0);
+    builder.add(makeRange(3, 0, 0), 2, 5);
+
+    const auto& arguments = builder.arguments();
+    CHECK(arguments.size() == 2);
+    CHECK(builder.size() == 2 * sizeof(IndirectArgumentBuilder::Arguments));
+    if (arguments.size() != 2) {
+        return;
+    }
+
+    CHECK(arguments[0].baseInstance == 0);
+    CHECK(arguments[0].draw.IndexCountPerInstance == 6);
+    CHECK(arguments[0].draw.InstanceCount == 5);
+    CHECK(arguments[0].draw.StartIndexLocation == 12);
+    CHECK(arguments[0].draw.BaseVertexLocation == 4);
+
+    // CX^Ẍʒu̓[g萔œn̂ŁAStartInstanceLocation ͏ 0
+    CHECK(arguments[1].baseInstance == 5);
+    CHECK(arguments[1].draw.InstanceCount == 2);
+    CHECK(arguments[1].draw.StartInstanceLocation == 0);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	܂܎̃ob`JnƁÃob`u邱
+ */
+TEST_CASE(indirectArgumentsReplaceEmptyBatch) {
+    IndirectArgumentBuilder builder;
+    builder.beginBatch(0);
+    builder.add(makeRange(3, 0, 0), 1, 0);
+    builder.beginBatch(3);
+    builder.beginBatch(7);
+    builder.add(makeRange(3, 0, 0), 1, 7);
+
+    const auto& batches = builder.batches();
+    CHECK(batches.size() == 2);
+    if (batches.size() != 2) {
+        return;
+    }
+    CHECK(batches[0].first == 0 && batches[0].count == 1 && batches[0].source == 0);
+    CHECK(batches[1].first == 1 && batches[1].count == 1 && batches[1].source == 7);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ob`JnɒǉƁAԍ 0 ̃ob`ɂ܂Ƃ߂邱
+ */
+TEST_CASE(indirectArgumentsAddWithoutBatch) {
+    IndirectArgumentBuilder builder;
+    builder.add(makeRange(3, 0, 0), 1, 0);
+    builder.add(makeRange(3, 0, 0), 1, 1);
+
+    const auto& batches = builder.batches();
+    CHECK(batches.size() == 1);
+    CHECK(!batches.empty() && batches[0].first == 0 && batches[0].count == 2 && batches[0].source == 0);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	write()  size() oCgǉɏނ
+ */
+TEST_CASE(indirectArgumentsWrite) {
+    IndirectArgumentBuilder builder;
+    builder.beginBatch(0);
+    builder.add(makeRange(6, 12, 4), 5, 0);
+    builder.add(makeRange(3, 0, 0), 2, 5);
+
+    // ݔ͈͂̊OςȂƂm߂
+    constexpr unsigned char guard = 0xcd;
+    unsigned char           buffer[3 * sizeof(IndirectArgumentBuilder::Arguments)]{};
+    std::memset(buffer, guard, sizeof(buffer));
+    builder.write(buffer);
+
+    CHECK(std::memcmp(buffer, builder.arguments().data(), static_cast<size_t>(builder.size())) == 0);
+    CHECK(buffer[builder.size()] == guard);
+
+    UINT baseInstance{};
+    std::memcpy(&baseInstance, buffer + sizeof(IndirectArgumentBuilder::Arguments), sizeof(baseInstance));
+    CHECK(baseInstance == 5);
+
+    // clear() ňob`ȂA܂Ȃ
+    builder.clear();
+    CHECK(builder.size() == 0);
+    CHECK(builder.batches().empty());
+    std::memset(buffer, guard, sizeof(buffer));
+    builder.write(buffer);
+    CHECK(buffer[0] == guard);
+}
@@ -0,0 +1,98 @@
+// eXg̎s
+// foCXg킸 CPU œmF
+// --benchmark w肷ƃx`}[Ns
+// --update-reference w肷ƎQƉ摜rɏ
+
+#include "test.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    int    failures_ = 0;       // s̃eXg̎s
+    int    argumentCount_ = 0;  // R}hC̐
+    char** arguments_{};        // R}hC
+}  // namespace
+
+namespace test {
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	o^eXgP[X擾
+     * @return	eXgP[X(o^)
+     */
+    [[nodiscard]] std::vector<Case>& cases() noexcept {
+        // ÓIϐ̏ɈˑȂ悤A֐Ő
+        static std::vector<Case> cases{};
+        return cases;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	eXgP[Xo^
+     * @param	name		eXg̖O
+     * @param	function	eXg֐
+     * @param	benchmark	x`}[N
+     * @return	 true
+     */
+    bool add(const char* name, Function function, bool benchmark) noexcept {
+        cases().push_back({ name, function, benchmark });
+        return true;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	s̃eXg̎sL^
+     * @param	file		t@C
+     * @param	line		sԍ
+     * @param	expression	s
+     */
+    void fail(const char* file, int line, const char* expression) noexcept {
+        std::printf("  %s(%d): CHECK(%s)\n", file, line, expression);
+        ++failures_;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	R}hCɃIvVw肳ꂽ
+     * @param	option	IvV
+     * @return	w肳Ă true
+     */
+    [[nodiscard]] bool hasOption(const char* option) noexcept {
+        for (int i = 1; i < argumentCount_; ++i) {
+            if (std::strcmp(arguments_[i], option) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+}  // namespace test
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Gg[֐
+ * @return	SẴeXg 0
+ */
+int main(int argc, char** argv) {
+    argumentCount_ = argc;
+    arguments_ = argv;
+
+    const bool benchmark = test::hasOption("--benchmark");
+
+    int run = 0;
+    int failed = 0;
+    for (const auto& testCase : test::cases()) {
+        if (testCase.benchmark && !benchmark) {
+            continue;
+        }
+
+        failures_ = 0;
+        testCase.function();
+        ++run;
+        if (failures_ != 0) {
+            ++failed;
+        }
+        std::printf("%s %s\n", failures_ == 0 ? "[  OK  ]" : "[ FAIL ]", testCase.name);
+    }
+
+    std::printf("%d / %d passed\n", run - failed, run);
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+// ՕJÕeXgƃx`}[N
+// Œ̏(ǂ̉ɕׂ)ŁA茋ʂƎՕ̕`Eɂ鎞ԂmF
+
+#include "test.h"
+#include "occlusion_culler.h"
+#include <chrono>
+#include <cstdio>
+#include <iterator>
+
+namespace {
+    constexpr uint32_t iterations_ = 200;       // v̌JԂ
+    constexpr int      wallCount_ = 8;          // ǂ1ӂ̖
+    constexpr float    wallSize_ = 4.0f;        // 1̑傫
+    constexpr float    wallDepth_ = 20.0f;      // ǂ̉s
+    constexpr int      boxCountX_ = 64;         // ɕׂ锠̐
+    constexpr int      boxCountY_ = 36;         // cɕׂ锠̐
+    constexpr float    boxSpacing_ = 1.25f;     // ̊Ԋu
+    constexpr float    boxDepth_ = 40.0f;       // ̉s
+    constexpr float    aspect_ = 16.0f / 9.0f;  // AXyNg
+
+    /// lp`(XY ʁA1 x 1)̒_
+    const VertexFormat::SourceVertex quadVertices_[] = {
+        { { -0.5f, -0.5f, 0.0f } },
+        { { -0.5f, 0.5f, 0.0f } },
+        { { 0.5f, 0.5f, 0.0f } },
+        { { 0.5f, -0.5f, 0.0f } },
+    };
+    const uint16_t quadIndices_[] = { 0, 1, 2, 0, 2, 3 };  // lp`̃CfbNX
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	lp`̌`̃f[^擾
+     * @return	`̃f[^
+     */
+    [[nodiscard]] ShapeGeometry quadGeometry() noexcept {
+        ShapeGeometry geometry{};
+        geometry.vertices = quadVertices_;
+        geometry.vertexCount = std::size(quadVertices_);
+        geometry.indices = quadIndices_;
+        geometry.indexCount = std::size(quadIndices_);
+        geometry.topology = PrimitiveTopology::TriangleList;
+        return geometry;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_ +Z J̃r[EvWFNVs擾
+     * @return	r[sƃvWFNVsZs
+     */
+    [[nodiscard]] DirectX::XMMATRIX viewProjection() noexcept {
+        using namespace DirectX;
+        const XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), XMVectorSet(0.0f, 0.0f, 1.0f, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+        const XMMATRIX projection = XMMatrixPerspectiveFovLH(XM_PI / 3.0f, aspect_, 0.1f, 1000.0f);
+        return XMMatrixMultiply(view, projection);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ǂՕƂēo^ĕ`悷
+     * ǂ X, Y Ƃ -16 ` 16 𕢂
+     * @param	culler		ՕJO
+     * @param	geometry	lp`̌`̃f[^
+     */
+    void rasterizeWalls(game::OcclusionCuller& culler, const ShapeGeometry& geometry) noexcept {
+        using namespace DirectX;
+        culler.begin(viewProjection());
+        for (int y = 0; y < wallCount_; ++y) {
+            for (int x = 0; x < wallCount_; ++x) {
+                const float    offset = (wallCount_ - 1) * 0.5f;
+                const XMMATRIX world = XMMatrixScaling(wallSize_, wallSize_, 1.0f) *
+                    XMMatrixTranslation((x - offset) * wallSize_, (y - offset) * wallSize_, wallDepth_);
+                culler.addOccluder(world, geometry);
+            }
+        }
+        (void)culler.rasterize();
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ׂ̂̂𐔂
+     * @param	culler	Օ`悵ՕJO
+     * @return	锠̐
+     */
+    [[nodiscard]] uint32_t countVisibleBoxes(const game::OcclusionCuller& culler) noexcept {
+        const DirectX::XMFLOAT3 extents{ 0.5f, 0.5f, 0.5f };
+        uint32_t                visible = 0;
+        for (int y = 0; y < boxCountY_; ++y) {
+            for (int x = 0; x < boxCountX_; ++x) {
+                const DirectX::XMFLOAT3 center{
+                    (x - (boxCountX_ - 1) * 0.5f) * boxSpacing_,
+                    (y - (boxCountY_ - 1) * 0.5f) * boxSpacing_,
+                    boxDepth_ };
+                visible += culler.isVisible(center, extents) ? 1 : 0;
+            }
+        }
+        return visible;
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ǂ̉̔BAǂ̊OƎO̔邱
+ */
+TEST_CASE(occlusionCullerHidesBoxesBehindWalls) {
+    const auto            geometry = quadGeometry();
+    game::OcclusionCuller culler;
+    rasterizeWalls(culler, geometry);
+
+    // ͕̔ǂ̌pڂƎlp`̑Ίp̏ɂ̂ŁAOp`̊ԂɌԂƌĂ܂
+    CHECK(!culler.isVisible({ 0.0f, 0.0f, boxDepth_ }, { 0.5f, 0.5f, 0.5f }));
+    CHECK(culler.isVisible({ 38.0f, 0.0f, boxDepth_ }, { 0.5f, 0.5f, 0.5f }));
+    CHECK(culler.isVisible({ 0.0f, 0.0f, wallDepth_ * 0.5f }, { 0.5f, 0.5f, 0.5f }));
+
+    // ǂ̓e(X  -32 ` 32)͂ݏoE 7 񂾂
+    CHECK(countVisibleBoxes(culler) == 2 * 7 * boxCountY_);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Օ̕`Ɣ̎Ԃv
+ */
+BENCHMARK_CASE(occlusionCullerFixedScene) {
+    using Clock = std::chrono::steady_clock;
+
+    const auto            geometry = quadGeometry();
+    game::OcclusionCuller culler;
+    rasterizeWalls(culler, geometry);
+    const uint32_t visible = countVisibleBoxes(culler);
+
+    Clock::duration rasterizeTime{};
+    Clock::duration testTime{};
+    uint32_t        checksum = 0;
+    for (uint32_t i = 0; i < iterations_; ++i) {
+        const auto start = Clock::now();
+        rasterizeWalls(culler, geometry);
+        const auto rasterized = Clock::now();
+        checksum += countVisibleBoxes(culler);
+        const auto tested = Clock::now();
+
+        rasterizeTime += rasterized - start;
+        testTime += tested - rasterized;
+    }
+
+    // 񓯂ʂɂȂ邱(vɌʂςĂȂ)
+    CHECK(checksum == visible * iterations_);
+
+    const auto milliseconds = [](Clock::duration duration) {
+        return std::chrono::duration<double, std::milli>(duration).count() / iterations_;
+    };
+    std::printf("  occluders %d, boxes %d (visible %u): rasterize %.3f ms, test %.3f ms per frame\n",
+        wallCount_ * wallCount_, boxCountX_ * boxCountY_, visible, milliseconds(rasterizeTime), milliseconds(testTime));
+}
@@ -0,0 +1,180 @@
+// _[Ot̃eXg
+// compile() ̓foCXgȂ̂ŁATCYƃACg𒼐ڎw肵ꎞeNX`ŊmF
+
+#include "test.h"
+#include "render_graph.h"
+#include <algorithm>
+
+namespace {
+    constexpr UINT64 alignment_ = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;  // ꎞeNX`̃ACg
+    constexpr UINT64 megabyte_ = 1024 * 1024;                                   // 1MB
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	O\[X̑̃AhX擾
+     * compile() ͊O\[XQƂȂ̂ŁAnull łȂ΂悢
+     * @param	index	\[X̔ԍ
+     * @return	\[X̃|C^
+     */
+    [[nodiscard]] ID3D12Resource* dummyResource(UINT index) noexcept {
+        static char storage[8]{};
+        return reinterpret_cast<ID3D12Resource*>(&storage[index]);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	ꎞeNX`錾
+     * @param	graph	_[Ot
+     * @param	name	\[X̖O
+     * @param	size	q[ṽTCY
+     * @return	\[X̃nh
+     */
+    [[nodiscard]] RenderGraph::Handle createTransient(RenderGraph& graph, const char* name, UINT64 size) noexcept {
+        D3D12_RESOURCE_DESC desc{};
+        desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+        desc.Width = 256;
+        desc.Height = 256;
+        desc.DepthOrArraySize = 1;
+        desc.MipLevels = 1;
+        desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+        desc.SampleDesc.Count = 1;
+        desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+
+        D3D12_RESOURCE_ALLOCATION_INFO allocation{};
+        allocation.SizeInBytes = size;
+        allocation.Alignment = alignment_;
+        return graph.createTexture(name, desc, allocation);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	\[X̃oA𐔂
+     * @param	barriers	oA
+     * @param	type		oA̎
+     * @param	resource	\[X̃nh
+     * @return	oA̐
+     */
+    [[nodiscard]] size_t countBarriers(const std::vector<RenderGraph::Barrier>& barriers, D3D12_RESOURCE_BARRIER_TYPE type, RenderGraph::Handle resource) noexcept {
+        return std::count_if(barriers.begin(), barriers.end(), [&](const RenderGraph::Barrier& barrier) {
+            return barrier.type == type && barrier.resource == resource;
+        });
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	o͂Ɋ^ȂpX폜邱
+ */
+TEST_CASE(renderGraphCullsUnusedPasses) {
+    RenderGraph graph;
+    const auto  backBuffer = graph.importResource("backBuffer", dummyResource(0), D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_PRESENT, true);
+    const auto  scene = createTransient(graph, "scene", megabyte_);
+    const auto  unused = createTransient(graph, "unused", megabyte_);
+    const auto  debug = createTransient(graph, "debug", megabyte_);
+
+    (void)graph.addPass("scene", nullptr).write(scene, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    (void)graph.addPass("composite", nullptr).read(scene, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE).write(backBuffer, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    (void)graph.addPass("unused", nullptr).write(unused, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    (void)graph.addPass("debug", nullptr).write(debug, D3D12_RESOURCE_STATE_RENDER_TARGET).sideEffect();
+
+    CHECK(graph.compile());
+    CHECK((graph.passOrder() == std::vector<UINT>{ 0, 1, 3 }));
+    CHECK(graph.stats().passCount == 3);
+    CHECK(graph.stats().culledPassCount == 1);
+
+    // 폜pXg\[X͔zuȂ
+    CHECK(graph.heapOffset(unused) == ~0ull);
+    CHECK(graph.stats().transientCount == 2);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Xe[gւ̑Jڂ̓oA𒣂Ȃ
+ */
+TEST_CASE(renderGraphElidesRedundantBarriers) {
+    RenderGraph graph;
+    const auto  backBuffer = graph.importResource("backBuffer", dummyResource(0), D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT, true);
+
+    (void)graph.addPass("opaque", nullptr).write(backBuffer, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    (void)graph.addPass("transparent", nullptr).write(backBuffer, D3D12_RESOURCE_STATE_RENDER_TARGET);
+
+    CHECK(graph.compile());
+    CHECK(graph.passBarriers(0).empty());
+    CHECK(graph.passBarriers(1).empty());
+
+    // s PRESENT ւ̑Jڂc
+    CHECK(graph.stats().barrierCount == 1);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ǂݍ݂ꍇ͌̃pX̓ǂݍ݃Xe[g܂Ƃ߂1őJڂ邱
+ */
+TEST_CASE(renderGraphWidensConsecutiveReads) {
+    constexpr auto pixel = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+    constexpr auto nonPixel = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+    constexpr auto target = D3D12_RESOURCE_STATE_RENDER_TARGET;
+
+    RenderGraph graph;
+    const auto  shadow = graph.importResource("shadow", dummyResource(0), target, target, true);
+    const auto  output0 = graph.importResource("output0", dummyResource(1), target, target, true);
+    const auto  output1 = graph.importResource("output1", dummyResource(2), target, target, true);
+
+    (void)graph.addPass("shadow", nullptr).write(shadow, target);
+    (void)graph.addPass("lighting", nullptr).read(shadow, pixel).write(output0, target);
+    (void)graph.addPass("particles", nullptr).read(shadow, nonPixel).write(output1, target);
+    (void)graph.addPass("shadowUpdate", nullptr).write(shadow, target);
+
+    CHECK(graph.compile());
+
+    // ŏ̓ǂݍ݂ŁȀ݂܂ł̓ǂݍ݃Xe[g܂Ƃ߂
+    const auto& lighting = graph.passBarriers(1);
+    CHECK(lighting.size() == 1);
+    CHECK(countBarriers(lighting, D3D12_RESOURCE_BARRIER_TYPE_TRANSITION, shadow) == 1);
+    CHECK(!lighting.empty() && lighting[0].before == target && lighting[0].after == (pixel | nonPixel));
+
+    // ɃXe[g܂ނ̂őJڂȂ
+    CHECK(graph.passBarriers(2).empty());
+
+    // ݂ł͓ǂݍ݃Xe[g̘aJڂ
+    const auto& shadowUpdate = graph.passBarriers(3);
+    CHECK(shadowUpdate.size() == 1);
+    CHECK(!shadowUpdate.empty() && shadowUpdate[0].before == (pixel | nonPixel) && shadowUpdate[0].after == target);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	ԂdȂȂꎞeNX`̈ɔzu邱
+ */
+TEST_CASE(renderGraphAliasesTransients) {
+    constexpr auto pixel = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+    constexpr auto target = D3D12_RESOURCE_STATE_RENDER_TARGET;
+
+    RenderGraph graph;
+    const auto  backBuffer = graph.importResource("backBuffer", dummyResource(0), target, target, true);
+    const auto  first = createTransient(graph, "first", megabyte_);
+    const auto  second = createTransient(graph, "second", megabyte_);
+    const auto  third = createTransient(graph, "third", megabyte_ / 2);
+
+    // (s): first [0, 1]Asecond [1, 2]Athird [2, 3]
+    (void)graph.addPass("pass0", nullptr).write(first, target);
+    (void)graph.addPass("pass1", nullptr).read(first, pixel).write(second, target);
+    (void)graph.addPass("pass2", nullptr).read(second, pixel).write(third, target);
+    (void)graph.addPass("pass3", nullptr).read(third, pixel).write(backBuffer, target);
+
+    CHECK(graph.compile());
+    CHECK(graph.stats().transientCount == 3);
+
+    // 傫̂zuAsecond  first ƐԂdȂ̂Ōւ炷
+    // third  first ƐԂdȂȂ̂Ő擪L
+    CHECK(graph.heapOffset(first) == 0);
+    CHECK(graph.heapOffset(second) == megabyte_);
+    CHECK(graph.heapOffset(third) == 0);
+    CHECK(graph.heapOffset(backBuffer) == ~0ull);
+    CHECK(graph.stats().transientHeapSize == 2 * megabyte_);
+
+    // ̈L͍̂ŏɎgpXŃGCAVOoA𒣂
+    CHECK(countBarriers(graph.passBarriers(0), D3D12_RESOURCE_BARRIER_TYPE_ALIASING, first) == 1);
+    CHECK(countBarriers(graph.passBarriers(1), D3D12_RESOURCE_BARRIER_TYPE_ALIASING, second) == 0);
+    CHECK(countBarriers(graph.passBarriers(2), D3D12_RESOURCE_BARRIER_TYPE_ALIASING, third) == 1);
+}
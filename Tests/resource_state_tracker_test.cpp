@@ -0,0 +1,167 @@
+// \[XXe[gǐՂ̃eXg
+// ǐՃNX D3D12  API Ă΂Ȃ̂ŁA\[X͔rɂg_~[̃AhXŊmF
+
+#include "test.h"
+#include "resource_state_tracker.h"
+
+namespace {
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	rɂg_~[̃\[X̃AhX擾
+     * @param	index	\[X̔ԍ
+     * @return	\[X̃|C^
+     */
+    [[nodiscard]] ID3D12Resource* dummyResource(UINT index) noexcept {
+        static char storage[8]{};
+        return reinterpret_cast<ID3D12Resource*>(&storage[index]);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	߂ĂoAw̑Jڂł邩
+     * @param	barrier		oA
+     * @param	resource	\[X
+     * @param	before		JڑÕXe[g
+     * @param	after		Jڌ̃Xe[g
+     * @param	flags		oÃtO
+     * @return	v true
+     */
+    [[nodiscard]] bool isTransition(const D3D12_RESOURCE_BARRIER& barrier, ID3D12Resource* resource, D3D12_RESOURCE_STATES before,
+        D3D12_RESOURCE_STATES after, D3D12_RESOURCE_BARRIER_FLAGS flags = D3D12_RESOURCE_BARRIER_FLAG_NONE) noexcept {
+        return barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION && barrier.Flags == flags && barrier.Transition.pResource == resource &&
+               barrier.Transition.StateBefore == before && barrier.Transition.StateAfter == after;
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	sȎJڂɑđJڂƁA߂ĂoȂJڌ̃Xe[g邱
+ */
+TEST_CASE(resourceStateTrackerRewritesPendingBarrier) {
+    ResourceStateTracker tracker;
+    const auto           resource = dummyResource(0);
+    tracker.track(resource, D3D12_RESOURCE_STATE_COMMON);
+
+    tracker.transition(resource, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    tracker.transition(resource, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+    CHECK(tracker.pending().size() == 1);
+    CHECK(isTransition(tracker.pending()[0], resource, D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
+    CHECK(tracker.state(resource) == D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    CHECK(tracker.stats().eliminated == 1);
+
+    // sς݂̃oAɂ͂܂Ƃ߂Ȃ
+    tracker.markIssued();
+    tracker.transition(resource, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    CHECK(tracker.pending().size() == 1);
+    CHECK(isTransition(tracker.pending()[0], resource, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_RENDER_TARGET));
+    CHECK(tracker.stats().issued == 1);
+    CHECK(tracker.stats().flushes == 1);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	A  B  A ƔsOɌ̃Xe[g֖߂ƁAoAȂ邱
+ */
+TEST_CASE(resourceStateTrackerCollapsesRoundTrip) {
+    ResourceStateTracker tracker;
+    const auto           resource = dummyResource(0);
+    tracker.track(resource, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+    tracker.transition(resource, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    tracker.transition(resource, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+    CHECK(tracker.pending().empty());
+    CHECK(tracker.state(resource) == D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    // ƍ폜 2 ȂĂ
+    CHECK(tracker.stats().eliminated == 2);
+
+    // ߂ĂoÂŔsĂȂ
+    tracker.markIssued();
+    CHECK(tracker.stats().issued == 0);
+    CHECK(tracker.stats().flushes == 0);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	sOɕoAIƁAJñoAʏ̃oAɂȂAȍ~̑Jڂ܂Ƃ߂邱
+ */
+TEST_CASE(resourceStateTrackerConvertsPendingBeginOnly) {
+    ResourceStateTracker tracker;
+    const auto           resource = dummyResource(0);
+    tracker.track(resource, D3D12_RESOURCE_STATE_RENDER_TARGET);
+
+    tracker.beginTransition(resource, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    CHECK(tracker.pending().size() == 1);
+    CHECK(isTransition(tracker.pending()[0], resource, D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+        D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY));
+
+    tracker.endTransition(resource);
+    CHECK(tracker.pending().size() == 1);
+    CHECK(isTransition(tracker.pending()[0], resource, D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
+    CHECK(tracker.stats().eliminated == 1);
+
+    // ʏ̃oAɂȂ̂ŁAJڂ͏ł܂Ƃ߂
+    tracker.transition(resource, D3D12_RESOURCE_STATE_COPY_SOURCE);
+    CHECK(tracker.pending().size() == 1);
+    CHECK(isTransition(tracker.pending()[0], resource, D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_COPY_SOURCE));
+
+    // Jn𔭍sɏIƁAĨoAǉ
+    tracker.markIssued();
+    tracker.beginTransition(resource, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    tracker.markIssued();
+    tracker.endTransition(resource);
+    CHECK(tracker.pending().size() == 1);
+    CHECK(isTransition(tracker.pending()[0], resource, D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_RENDER_TARGET,
+        D3D12_RESOURCE_BARRIER_FLAG_END_ONLY));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	߂ĂoA폜ƁÃoAL^Ă郊\[Ẍʒul߂邱
+ */
+TEST_CASE(resourceStateTrackerReindexesAfterErase) {
+    ResourceStateTracker tracker;
+    const auto           first = dummyResource(0);
+    const auto           second = dummyResource(1);
+    tracker.track(first, D3D12_RESOURCE_STATE_COMMON);
+    tracker.track(second, D3D12_RESOURCE_STATE_COMMON);
+
+    tracker.transition(first, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    tracker.transition(second, D3D12_RESOURCE_STATE_RENDER_TARGET);
+
+    // 擪̃oA폜A2 ڂ̃oA擪Ɉڂ
+    tracker.transition(first, D3D12_RESOURCE_STATE_COMMON);
+    CHECK(tracker.pending().size() == 1);
+
+    // ڂʒũoA
+    tracker.transition(second, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    CHECK(tracker.pending().size() == 1);
+    CHECK(isTransition(tracker.pending()[0], second, D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	oA𗭂߂Ă郊\[X̓o^ƁÃ\[X̃oA폜邱
+ */
+TEST_CASE(resourceStateTrackerUntrackDropsPendingBarriers) {
+    ResourceStateTracker tracker;
+    const auto           released = dummyResource(0);
+    const auto           kept = dummyResource(1);
+    tracker.track(released, D3D12_RESOURCE_STATE_COMMON);
+    tracker.track(kept, D3D12_RESOURCE_STATE_COMMON);
+
+    tracker.transition(released, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    tracker.aliasing(released);
+    tracker.transition(kept, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    CHECK(tracker.pending().size() == 3);
+
+    tracker.untrack(released);
+    CHECK(tracker.pending().size() == 1);
+    CHECK(isTransition(tracker.pending()[0], kept, D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_RENDER_TARGET));
+
+    // coÄʒul߂Ă
+    tracker.transition(kept, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    CHECK(tracker.pending().size() == 1);
+    CHECK(isTransition(tracker.pending()[0], kept, D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
+}
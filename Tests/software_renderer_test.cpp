@@ -0,0 +1,343 @@
+// \tgEFA`̃eXgƃx`}[N
+// Œ̏ʂ`悵ĕۑς݂̎QƉ摜ƔrA`ɂ鎞Ԃv
+// QƉ摜̃pX͍ƃfBNg(Tests)̑΃pXB--update-reference w肷ƎQƉ摜
+
+#include "test.h"
+#include "software_renderer.h"
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace {
+    constexpr const char* referencePath_ = "data/software_renderer.ppm";  // QƉ摜̃pX
+    constexpr uint32_t    width_ = 256;                                    // `̕
+    constexpr uint32_t    height_ = 144;                                   // `̍
+    constexpr int         channelTolerance_ = 2;                           // vƂ݂ȂF̍(e`l)
+    constexpr size_t      maxDifferentPixels_ = width_ * height_ / 200;    // esvsNZ(0.5%)
+    constexpr uint32_t    benchmarkWidth_ = 1280;                          // x`}[N̕`̕
+    constexpr uint32_t    benchmarkHeight_ = 720;                          // x`}[N̕`̍
+    constexpr uint32_t    benchmarkFrames_ = 20;                           // x`}[Nŕ`悷t[
+    constexpr int         benchmarkColumns_ = 64;                          // x`}[Nŕׂ
+    constexpr int         benchmarkRows_ = 36;                             // x`}[Nŕׂs
+
+    const float clearColor_[4] = { 0.1f, 0.1f, 0.2f, 1.0f };  // NAF
+
+    /// lp`(XY ʁA1 x 1)̒_BQuadPolygon Ɠ
+    const VertexFormat::SourceVertex quadVertices_[] = {
+        { { -0.5f, 0.5f, 0.0f } },
+        { { 0.5f, 0.5f, 0.0f } },
+        { { -0.5f, -0.5f, 0.0f } },
+        { { 0.5f, -0.5f, 0.0f } },
+    };
+    const uint16_t quadIndices_[] = { 0, 1, 2, 3 };  // lp`̃CfbNX(Op`Xgbv)
+
+    /// Op`̒_BTrianglePolygon Ɠ
+    const VertexFormat::SourceVertex triangleVertices_[] = {
+        { { 0.0f, 0.5f, 0.0f } },
+        { { 0.5f, -0.5f, 0.0f } },
+        { { -0.5f, -0.5f, 0.0f } },
+    };
+    const uint16_t triangleIndices_[] = { 0, 1, 2 };  // Op`̃CfbNX
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_FEsnorm16 W̌`̃f[^쐬
+     * QuadPolygon  TrianglePolygon  D3D12 Ɉˑ̂ŁAf[^ŗpӂ
+     * @param	vertices	_f[^
+     * @param	indices		CfbNXf[^
+     * @param	topology	v~eBug|W[
+     * @return	`̃f[^
+     */
+    template <size_t VertexCount, size_t IndexCount>
+    [[nodiscard]] ShapeGeometry makeGeometry(const VertexFormat::SourceVertex (&vertices)[VertexCount], const uint16_t (&indices)[IndexCount],
+        PrimitiveTopology topology) noexcept {
+        ShapeGeometry geometry{};
+        geometry.vertices = vertices;
+        geometry.vertexCount = static_cast<uint32_t>(VertexCount);
+        geometry.format = VertexFormat::compact();
+        geometry.indices = indices;
+        geometry.indexCount = static_cast<uint32_t>(IndexCount);
+        geometry.topology = topology;
+        return geometry;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	_J̃r[EvWFNVs擾
+     * @param	aspect	AXyNg
+     * @return	r[sƃvWFNVsZs
+     */
+    [[nodiscard]] DirectX::XMMATRIX viewProjection(float aspect) noexcept {
+        using namespace DirectX;
+        const XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(0.0f, 0.0f, -10.0f, 1.0f), XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+        const XMMATRIX projection = XMMatrixPerspectiveFovLH(XM_PI / 3.0f, aspect, 0.1f, 100.0f);
+        return XMMatrixMultiply(view, projection);
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	s`̃CX^Xf[^쐬
+     * GameObjectManager::draw() ƓA[hsƃr[EvWFNVsZĊi[
+     * @param	position		ʒu
+     * @param	angle			Z ̉](WA)
+     * @param	scale			g嗦
+     * @param	color			J[
+     * @param	viewProjection	r[sƃvWFNVsZs
+     * @return	CX^Xf[^
+     */
+    [[nodiscard]] InstanceData XM_CALLCONV makeInstance(const DirectX::XMFLOAT3& position, float angle, const DirectX::XMFLOAT3& scale,
+        const DirectX::XMFLOAT4& color, DirectX::FXMMATRIX viewProjection) noexcept {
+        using namespace DirectX;
+        const XMMATRIX world = XMMatrixScaling(scale.x, scale.y, scale.z) * XMMatrixRotationRollPitchYaw(0.0f, 0.0f, angle) *
+            XMMatrixTranslation(position.x, position.y, position.z);
+
+        InstanceData data{};
+        XMStoreFloat4x4(&data.worldViewProjection_, XMMatrixMultiply(world, viewProjection));
+        data.color_ = color;
+        return data;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	kCX^Xf[^쐬
+     * GameObject::compactInstanceData() Ɠ`ɗʎq
+     * @param	position	ʒu
+     * @param	angle		Z ̉](WA)
+     * @param	scale		g嗦
+     * @param	color		J[
+     * @return	CX^Xf[^
+     */
+    [[nodiscard]] CompactInstanceData makeCompactInstance(const DirectX::XMFLOAT3& position, float angle, const DirectX::XMFLOAT3& scale,
+        const DirectX::XMFLOAT4& color) noexcept {
+        using namespace DirectX;
+
+        CompactInstanceData data{};
+        data.position_ = position;
+        PackedVector::XMStoreUByteN4(&data.color_, XMLoadFloat4(&color));
+        PackedVector::XMStoreShortN4(&data.rotation_, XMQuaternionRotationRollPitchYaw(0.0f, 0.0f, angle));
+        PackedVector::XMStoreHalf4(&data.scale_, XMVectorSetW(XMLoadFloat3(&scale), 0.0f));
+        return data;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	Œ̏ʂ`悷
+     * sȎlp`(s`)AsȎOp`(k`)AȎlp`(s`)̏ɕ`悷
+     * @param	renderer	`
+     */
+    void renderScene(SoftwareRenderer& renderer) noexcept {
+        using namespace DirectX;
+
+        const ShapeGeometry quad = makeGeometry(quadVertices_, quadIndices_, PrimitiveTopology::TriangleStrip);
+        const ShapeGeometry triangle = makeGeometry(triangleVertices_, triangleIndices_, PrimitiveTopology::TriangleList);
+        const XMMATRIX      vp = viewProjection(static_cast<float>(width_) / height_);
+
+        renderer.clear(clearColor_);
+
+        // sƉ]ςlp` 4 x 3 ɕׂ
+        InstanceData quads[12]{};
+        for (int i = 0; i < 12; ++i) {
+            const XMFLOAT3 position{ -6.0f + (i % 4) * 4.0f, -3.0f + (i / 4) * 3.0f, (i % 3) * 0.5f };
+            const XMFLOAT4 color{ (i % 4) / 3.0f, (i / 4) / 2.0f, 1.0f - (i % 4) / 3.0f, 1.0f };
+            quads[i] = makeInstance(position, i * 0.3f, { 3.0f, 2.5f, 1.0f }, color, vp);
+        }
+        renderer.draw(quad, quads, static_cast<uint32_t>(std::size(quads)));
+
+        // lp`ɐHގOp`
+        CompactInstanceData triangles[3]{};
+        for (int i = 0; i < 3; ++i) {
+            const XMFLOAT3 position{ -4.0f + i * 4.0f, 0.0f, 0.25f };
+            const XMFLOAT4 color{ 1.0f, 0.8f - i * 0.3f, 0.2f, 1.0f };
+            triangles[i] = makeCompactInstance(position, i * 0.7f, { 4.0f, 4.0f, 1.0f }, color);
+        }
+        renderer.draw(triangle, triangles, static_cast<uint32_t>(std::size(triangles)), vp);
+
+        // O؂锼̑
+        const InstanceData band = makeInstance({ 0.0f, -1.0f, -2.0f }, 0.0f, { 14.0f, 2.0f, 1.0f }, { 1.0f, 1.0f, 1.0f, 0.5f }, vp);
+        renderer.draw(quad, &band, 1);
+
+        renderer.resolve();
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	PPM(P6)`̉摜ǂݍ
+     * @param	path	ǂݍރt@C̃pX
+     * @param	width	ǂݍ񂾉摜̕
+     * @param	height	ǂݍ񂾉摜̍
+     * @return	RGB ̉f(ǂݍ߂Ȃ΋)
+     */
+    [[nodiscard]] std::vector<uint8_t> readPpm(const char* path, uint32_t& width, uint32_t& height) {
+        std::ifstream file(path, std::ios::binary);
+        std::string   magic;
+        uint32_t      maxValue{};
+        if (!(file >> magic >> width >> height >> maxValue) || magic != "P6" || maxValue != 255) {
+            return {};
+        }
+        // wb_[̌͋ 1 
+        file.get();
+
+        std::vector<uint8_t> pixels(size_t(width) * height * 3);
+        if (!file.read(reinterpret_cast<char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()))) {
+            return {};
+        }
+        return pixels;
+    }
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	CX^Xiqɕׂʂ`悷
+     * @param	renderer		`
+     * @param	compact			k`ŕ`悷邩
+     * @param	quads			s`̃CX^Xf[^
+     * @param	compactQuads	kCX^Xf[^
+     */
+    void renderGrid(SoftwareRenderer& renderer, bool compact, const std::vector<InstanceData>& quads,
+        const std::vector<CompactInstanceData>& compactQuads) noexcept {
+        const ShapeGeometry quad = makeGeometry(quadVertices_, quadIndices_, PrimitiveTopology::TriangleStrip);
+        renderer.clear(clearColor_);
+        if (compact) {
+            renderer.draw(quad, compactQuads.data(), static_cast<uint32_t>(compactQuads.size()),
+                viewProjection(static_cast<float>(benchmarkWidth_) / benchmarkHeight_));
+        }
+        else {
+            renderer.draw(quad, quads.data(), static_cast<uint32_t>(quads.size()));
+        }
+        renderer.resolve();
+    }
+}  // namespace
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	Œ̏ʂ̕`挋ʂQƉ摜ƈv邱
+ * ӂ̏̃sNZ͕_̊ۂ߂ŕς肤̂ŁAF̍ƕsvsNZɋe͈݂͂
+ */
+TEST_CASE(softwareRendererMatchesReference) {
+    SoftwareRenderer renderer;
+    CHECK(renderer.create(width_, height_));
+
+    const auto start = std::chrono::steady_clock::now();
+    renderScene(renderer);
+    const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::printf("  %ux%u, %u instances, %u triangles: %.3f ms\n", width_, height_, renderer.stats().instances, renderer.stats().triangles, elapsed);
+
+    if (test::hasOption("--update-reference")) {
+        CHECK(renderer.writePpm(referencePath_));
+        std::printf("  updated %s\n", referencePath_);
+        return;
+    }
+
+    uint32_t   width{};
+    uint32_t   height{};
+    const auto reference = readPpm(referencePath_, width, height);
+    CHECK(!reference.empty());
+    CHECK(width == width_ && height == height_);
+    if (reference.empty() || width != width_ || height != height_) {
+        return;
+    }
+
+    size_t different = 0;
+    int    maxDifference = 0;
+    for (size_t i = 0; i < size_t(width_) * height_; ++i) {
+        const uint32_t pixel = renderer.color()[i];
+        int            difference = 0;
+        for (uint32_t channel = 0; channel < 3; ++channel) {
+            const int actual = static_cast<int>((pixel >> (channel * 8)) & 0xff);
+            difference = (std::max)(difference, std::abs(actual - static_cast<int>(reference[i * 3 + channel])));
+        }
+        maxDifference = (std::max)(maxDifference, difference);
+        different += difference > channelTolerance_ ? 1 : 0;
+    }
+    if (different != 0) {
+        std::printf("  %zu pixels differ (max difference %d)\n", different, maxDifference);
+    }
+    CHECK(different <= maxDifferentPixels_);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	`󖈂̍W̊i[͈͂CX^X̕ϊɊ܂߂ĕ`悷ƁA͈͂gȂ`ƈv邱
+ * i[͈͂ Shape::create() Ɠ AABB 狁߁AGameObject::instanceWorld() Ɠϊ[hs̑OɊ|
+ */
+TEST_CASE(softwareRendererPositionRangeMatchesIdentity) {
+    using namespace DirectX;
+
+    const ShapeGeometry quad = makeGeometry(quadVertices_, quadIndices_, PrimitiveTopology::TriangleStrip);
+    ShapeGeometry       ranged = quad;
+    ranged.positionRange = quad.format.positionRange({ 0.0f, 0.0f, 0.0f }, { 0.5f, 0.5f, 0.0f });
+    const auto& range = ranged.positionRange;
+    CHECK(range.scale.x != 1.0f || range.scale.y != 1.0f);
+
+    const XMMATRIX vp = viewProjection(static_cast<float>(width_) / height_);
+    const XMMATRIX world = XMMatrixScaling(6.0f, 4.0f, 1.0f) * XMMatrixRotationRollPitchYaw(0.0f, 0.0f, 0.4f) * XMMatrixTranslation(1.0f, 0.5f, 0.0f);
+    const XMMATRIX decode = XMMatrixScaling(range.scale.x, range.scale.y, range.scale.z) * XMMatrixTranslation(range.bias.x, range.bias.y, range.bias.z);
+
+    InstanceData identityInstance{};
+    XMStoreFloat4x4(&identityInstance.worldViewProjection_, world * vp);
+    identityInstance.color_ = { 1.0f, 0.5f, 0.25f, 1.0f };
+    InstanceData rangedInstance = identityInstance;
+    XMStoreFloat4x4(&rangedInstance.worldViewProjection_, decode * world * vp);
+
+    SoftwareRenderer expected;
+    SoftwareRenderer actual;
+    CHECK(expected.create(width_, height_));
+    CHECK(actual.create(width_, height_));
+    expected.clear(clearColor_);
+    expected.draw(quad, &identityInstance, 1);
+    expected.resolve();
+    actual.clear(clearColor_);
+    actual.draw(ranged, &rangedInstance, 1);
+    actual.resolve();
+
+    // ʎq̌덷͕ӂ̏̃sNZɂ
+    size_t different = 0;
+    for (size_t i = 0; i < size_t(width_) * height_; ++i) {
+        different += expected.color()[i] != actual.color()[i] ? 1 : 0;
+    }
+    CHECK(different <= maxDifferentPixels_);
+}
+
+//---------------------------------------------------------------------------------
+/**
+ * @brief	CX^Xiqɕׂʂ̕`掞Ԃv
+ * s`ƈk`ꂼŌv
+ */
+BENCHMARK_CASE(softwareRendererThroughput) {
+    using namespace DirectX;
+    using Clock = std::chrono::steady_clock;
+
+    // ʑŜɏdȂ荇lp`ׂ
+    const XMMATRIX                          vp = viewProjection(static_cast<float>(benchmarkWidth_) / benchmarkHeight_);
+    std::vector<InstanceData>        quads;
+    std::vector<CompactInstanceData> compactQuads;
+    for (int y = 0; y < benchmarkRows_; ++y) {
+        for (int x = 0; x < benchmarkColumns_; ++x) {
+            const XMFLOAT3 position{ (x - benchmarkColumns_ * 0.5f) * 0.33f, (y - benchmarkRows_ * 0.5f) * 0.33f, ((x + y) % 5) * 0.1f };
+            const XMFLOAT4 color{ float(x) / benchmarkColumns_, float(y) / benchmarkRows_, 0.5f, 1.0f };
+            quads.push_back(makeInstance(position, (x + y) * 0.1f, { 0.5f, 0.5f, 1.0f }, color, vp));
+            compactQuads.push_back(makeCompactInstance(position, (x + y) * 0.1f, { 0.5f, 0.5f, 1.0f }, color));
+        }
+    }
+
+    SoftwareRenderer renderer;
+    CHECK(renderer.create(benchmarkWidth_, benchmarkHeight_));
+
+    for (const bool compact : { false, true }) {
+        const auto start = Clock::now();
+        for (uint32_t frame = 0; frame < benchmarkFrames_; ++frame) {
+            renderGrid(renderer, compact, quads, compactQuads);
+        }
+        const double milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / benchmarkFrames_;
+        CHECK(renderer.stats().instances == quads.size());
+
+        std::printf("  %s: %ux%u, %u instances, %u triangles: %.3f ms per frame (%.1f k instances/s)\n", compact ? "compact" : "matrix ",
+            benchmarkWidth_, benchmarkHeight_, renderer.stats().instances, renderer.stats().triangles, milliseconds,
+            renderer.stats().instances / milliseconds);
+    }
+}
@@ -0,0 +1,69 @@
+// eXg̓o^Ǝs
+
+#pragma once
+
+#include <vector>
+
+namespace test {
+    using Function = void (*)();  /// eXg֐
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	eXgP[X
+     */
+    struct Case {
+        const char* name{};       /// eXg̖O
+        Function    function{};   /// eXg֐
+        bool        benchmark{};  /// x`}[N(--benchmark w肵s)
+    };
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	o^eXgP[X擾
+     * @return	eXgP[X(o^)
+     */
+    [[nodiscard]] std::vector<Case>& cases() noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	eXgP[Xo^
+     * TEST_CASE / BENCHMARK_CASE Ăяo
+     * @param	name		eXg̖O
+     * @param	function	eXg֐
+     * @param	benchmark	x`}[N
+     * @return	 true(ÓIϐ̏œo^邽)
+     */
+    bool add(const char* name, Function function, bool benchmark) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	s̃eXg̎sL^
+     * @param	file		t@C
+     * @param	line		sԍ
+     * @param	expression	s
+     */
+    void fail(const char* file, int line, const char* expression) noexcept;
+
+    //---------------------------------------------------------------------------------
+    /**
+     * @brief	R}hCɃIvVw肳ꂽ
+     * @param	option	IvV(--benchmark Ȃ)
+     * @return	w肳Ă true
+     */
+    [[nodiscard]] bool hasOption(const char* option) noexcept;
+}  // namespace test
+
+/// eXgP[X`
+#define TEST_CASE(name)                                                      \
+    static void name();                                                      \
+    static const bool name##Registered_ = test::add(#name, &name, false);   \
+    static void name()
+
+/// x`}[N`(vʂ͕Wo͂֏o)
+#define BENCHMARK_CASE(name)                                                 \
+    static void name();                                                      \
+    static const bool name##Registered_ = test::add(#name, &name, true);    \
+    static void name()
+
+/// UȂeXgsɂ(eXg͑)
+#define CHECK(expression) ((expression) ? (void)0 : test::fail(__FILE__, __LINE__, #expression))